@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Easy2Read public plugin API (Tofu Remover).
+ *
+ * Lets other SKSE plugins use the same sanitizer tables, settings and
+ * statistics as Easy2Read's own text hooks. Copy this header into your
+ * project; it has no dependencies.
+ *
+ * Easy2Read broadcasts the interface once all plugins are loaded
+ * (kPostPostLoad). To receive it, register a listener for "Easy2Read" during
+ * plugin load:
+ *
+ *   SKSE::GetMessagingInterface()->RegisterListener(
+ *       Easy2ReadAPI::kPluginName, [](SKSE::MessagingInterface::Message *a_msg) {
+ *         if (a_msg->type == Easy2ReadAPI::kMessage_Interface) {
+ *           auto *message =
+ *               static_cast<Easy2ReadAPI::InterfaceMessage *>(a_msg->data);
+ *           if (message->version >= Easy2ReadAPI::kInterfaceVersion1) {
+ *             g_easy2read = message->interfaceV1;
+ *           }
+ *         }
+ *       });
+ *
+ * All functions are thread-safe and never allocate on behalf of the caller.
+ */
+namespace Easy2ReadAPI {
+
+constexpr const char *kPluginName = "Easy2Read";
+
+// Message type of the interface broadcast ('E2RI')
+constexpr std::uint32_t kMessage_Interface = 0x45325249;
+
+constexpr std::uint32_t kInterfaceVersion1 = 1;
+
+/**
+ * One string to sanitize. Inputs need not be NUL-terminated; outputs are
+ * never NUL-terminated.
+ */
+struct SanitizeJob {
+  const char *input = nullptr;    // [in] UTF-8 (or legacy CP1252) text
+  std::size_t inputLength = 0;    // [in] Length of input in bytes
+  char *output = nullptr;         // [in] Caller-owned destination buffer
+  std::size_t outputCapacity = 0; // [in] Size of the destination buffer
+  std::size_t outputLength = 0;   // [out] Full sanitized length; a value
+                                  //       above outputCapacity means the
+                                  //       output was truncated
+  bool changed = false;           // [out] Output fit and differs from
+                                  //       the input
+};
+
+/**
+ * Sanitizer statistics (shared with Easy2Read's built-in hooks).
+ */
+struct Stats {
+  std::uint64_t scanned = 0;   // Strings checked for unsupported characters
+  std::uint64_t flagged = 0;   // Strings that needed sanitization
+  std::uint64_t sanitized = 0; // Strings run through replacement
+  std::uint64_t bytesIn = 0;   // Input bytes of sanitized strings
+  std::uint64_t bytesOut = 0;  // Output bytes of sanitized strings
+};
+
+struct InterfaceV1 {
+  std::uint32_t version; // kInterfaceVersion1
+  std::uint32_t size;    // sizeof(InterfaceV1)
+
+  // True if sanitizing the text would modify it (reads text in place)
+  bool (*NeedsSanitization)(const char *text, std::size_t length);
+
+  // Sanitize a batch of strings into caller-provided buffers.
+  // Returns the number of jobs whose output fit in their buffer.
+  std::size_t (*SanitizeInto)(SanitizeJob *jobs, std::size_t count);
+
+  // Snapshot of sanitizer statistics
+  void (*GetStats)(Stats *out);
+};
+
+/**
+ * Payload of kMessage_Interface. Newer versions append members; check
+ * version before reading them.
+ */
+struct InterfaceMessage {
+  std::uint32_t version;          // Highest interface version available
+  const InterfaceV1 *interfaceV1; // Always present
+};
+
+} // namespace Easy2ReadAPI
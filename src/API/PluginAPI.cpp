@@ -0,0 +1,85 @@
+#include "PluginAPI.h"
+#include "PCH.h"
+#include "TextSanitization/TextSanitizer.h"
+
+namespace Easy2Read {
+
+namespace {
+bool NeedsSanitization(const char *a_text, std::size_t a_length) {
+  if (!a_text || a_length == 0) {
+    return false;
+  }
+  return TextSanitizer::GetSingleton()->NeedsSanitization(
+      std::string_view(a_text, a_length));
+}
+
+std::size_t SanitizeInto(Easy2ReadAPI::SanitizeJob *a_jobs,
+                         std::size_t a_count) {
+  if (!a_jobs) {
+    return 0;
+  }
+
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  std::size_t fitted = 0;
+
+  for (std::size_t i = 0; i < a_count; ++i) {
+    auto &job = a_jobs[i];
+    const std::string_view input =
+        job.input ? std::string_view(job.input, job.inputLength)
+                  : std::string_view();
+
+    job.outputLength =
+        sanitizer->SanitizeInto(input, job.output, job.outputCapacity);
+
+    const bool fits = job.outputLength <= job.outputCapacity;
+    job.changed =
+        fits && std::string_view(job.output, job.outputLength) != input;
+    if (fits) {
+      ++fitted;
+    }
+  }
+
+  return fitted;
+}
+
+void GetStats(Easy2ReadAPI::Stats *a_out) {
+  if (!a_out) {
+    return;
+  }
+  const auto stats = TextSanitizer::GetSingleton()->GetStats();
+  a_out->scanned = stats.scanned;
+  a_out->flagged = stats.flagged;
+  a_out->sanitized = stats.sanitized;
+  a_out->bytesIn = stats.bytesIn;
+  a_out->bytesOut = stats.bytesOut;
+}
+
+constexpr Easy2ReadAPI::InterfaceV1 kInterfaceV1{
+    Easy2ReadAPI::kInterfaceVersion1,
+    static_cast<std::uint32_t>(sizeof(Easy2ReadAPI::InterfaceV1)),
+    &NeedsSanitization,
+    &SanitizeInto,
+    &GetStats,
+};
+} // namespace
+
+const Easy2ReadAPI::InterfaceV1 *PluginAPI::GetInterfaceV1() {
+  return &kInterfaceV1;
+}
+
+void PluginAPI::Broadcast() {
+  auto *messaging = SKSE::GetMessagingInterface();
+  if (!messaging) {
+    return;
+  }
+
+  Easy2ReadAPI::InterfaceMessage message{Easy2ReadAPI::kInterfaceVersion1,
+                                         GetInterfaceV1()};
+  messaging->Dispatch(Easy2ReadAPI::kMessage_Interface, &message,
+                      sizeof(message), nullptr);
+
+  SKSE::log::info("PluginAPI: Broadcast sanitizer interface v{}",
+                  message.version);
+}
+
+} // namespace Easy2Read
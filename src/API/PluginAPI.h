@@ -0,0 +1,17 @@
+#pragma once
+
+#include "API/Easy2ReadAPI.h"
+
+namespace Easy2Read {
+
+/// Implementation of the public Easy2ReadAPI interface for other plugins.
+class PluginAPI {
+public:
+  /// Broadcast the interface to every plugin listening for "Easy2Read"
+  static void Broadcast();
+
+  /// The version 1 function table
+  [[nodiscard]] static const Easy2ReadAPI::InterfaceV1 *GetInterfaceV1();
+};
+
+} // namespace Easy2Read
@@ -3,18 +3,36 @@
 
 namespace Easy2Read {
 
+namespace {
+constexpr auto kSettingsPath = L"Data/SKSE/Plugins/Easy2Read.ini";
+
+void ReadHookKeys(const CSimpleIniA &ini, Settings &settings) {
+  // [TextSanitization.Hooks] - per-hook enable settings
+  settings.hookEnableDescription = ini.GetBoolValue(
+      "TextSanitization.Hooks", "EnableDescriptionHook", true);
+  settings.hookEnableDialogue =
+      ini.GetBoolValue("TextSanitization.Hooks", "EnableDialogueHook", true);
+  settings.hookEnableDialogueMenu = ini.GetBoolValue(
+      "TextSanitization.Hooks", "EnableDialogueMenuHook", true);
+  settings.hookEnableQuest =
+      ini.GetBoolValue("TextSanitization.Hooks", "EnableQuestHook", true);
+  settings.hookEnableMapMarker =
+      ini.GetBoolValue("TextSanitization.Hooks", "EnableMapMarkerHook", true);
+  settings.hookEnableNpcName =
+      ini.GetBoolValue("TextSanitization.Hooks", "EnableNpcNameHook", true);
+}
+} // namespace
+
 Settings *Settings::GetSingleton() {
   static Settings singleton;
   return &singleton;
 }
 
 void Settings::Load() {
-  constexpr auto path = L"Data/SKSE/Plugins/Easy2Read.ini";
-
   CSimpleIniA ini;
   ini.SetUnicode();
 
-  const auto rc = ini.LoadFile(path);
+  const auto rc = ini.LoadFile(kSettingsPath);
   if (rc < 0) {
     SKSE::log::warn("Easy2Read.ini not found, using defaults");
   } else {
@@ -28,10 +46,19 @@ void Settings::Load() {
         ini.GetLongValue("General", "ControllerToggleButton", 0x8000));
     controllerScrollSpeed = static_cast<float>(
         ini.GetDoubleValue("General", "ControllerScrollSpeed", 3.0));
+    bookCacheSizeMB = static_cast<std::uint32_t>(
+        ini.GetLongValue("General", "BookCacheSizeMB", 16));
+    bookPrefetch = ini.GetBoolValue("General", "PrefetchBooks", true);
+    pageMode = ini.GetBoolValue("General", "PageMode", false);
+    precompileBooks = ini.GetBoolValue("General", "PrecompileBooks", false);
     SKSE::log::info(
         "  Overlay: {} (key: {}, controller: 0x{:X}, scroll speed: {})",
         overlayEnabled ? "enabled" : "disabled", toggleKey,
         controllerToggleButton, controllerScrollSpeed);
+    SKSE::log::info(
+        "  Book cache: {} MB, prefetch: {}, page mode: {}, precompile: {}",
+        bookCacheSizeMB, bookPrefetch ? "on" : "off", pageMode ? "on" : "off",
+        precompileBooks ? "on" : "off");
 
     // [TextSanitization]
     sanitizationEnabled = ini.GetBoolValue("TextSanitization", "Enable", true);
@@ -42,30 +69,38 @@ void Settings::Load() {
         ini.GetBoolValue("TextSanitization", "LogReplacements", false);
     sanitizationMaxExpansionRatio = static_cast<float>(
         ini.GetDoubleValue("TextSanitization", "MaxExpansionRatio", 3.0));
+    sanitizationAuditReport =
+        ini.GetBoolValue("TextSanitization", "AuditReport", true);
+    sanitizationLatin1ToUTF8 =
+        ini.GetBoolValue("TextSanitization", "Latin1ToUTF8", false);
+    sanitizationProfileSampleRate = static_cast<std::uint32_t>(
+        ini.GetLongValue("TextSanitization", "ProfileSampleRate", 0));
+    sanitizationCapture =
+        ini.GetBoolValue("TextSanitization", "CaptureHookTraffic", false);
+    sanitizationPersistentCache =
+        ini.GetBoolValue("TextSanitization", "PersistentCache", true);
 
     SKSE::log::info("  TextSanitization: {} (mode: {}{})",
                     sanitizationEnabled ? "enabled" : "disabled",
                     sanitizationMode, sanitizationDebugMode ? ", debug" : "");
 
-    // [TextSanitization.Hooks] - per-hook enable settings
-    hookEnableDescription = ini.GetBoolValue("TextSanitization.Hooks",
-                                             "EnableDescriptionHook", true);
-    hookEnableDialogue =
-        ini.GetBoolValue("TextSanitization.Hooks", "EnableDialogueHook", true);
-    hookEnableDialogueMenu = ini.GetBoolValue("TextSanitization.Hooks",
-                                              "EnableDialogueMenuHook", true);
-    hookEnableQuest =
-        ini.GetBoolValue("TextSanitization.Hooks", "EnableQuestHook", true);
-    hookEnableMapMarker =
-        ini.GetBoolValue("TextSanitization.Hooks", "EnableMapMarkerHook", true);
-    hookEnableNpcName =
-        ini.GetBoolValue("TextSanitization.Hooks", "EnableNpcNameHook", true);
+    ReadHookKeys(ini, *this);
   }
 
   // Load theming from separate file
   LoadTheme();
 }
 
+void Settings::LoadHooks() {
+  CSimpleIniA ini;
+  ini.SetUnicode();
+  if (ini.LoadFile(kSettingsPath) < 0) {
+    SKSE::log::warn("Easy2Read.ini not found, hook settings unchanged");
+    return;
+  }
+  ReadHookKeys(ini, *this);
+}
+
 void Settings::LoadTheme() {
   constexpr auto themePath = L"Data/SKSE/Plugins/Easy2Read_Theme.ini";
 
@@ -28,6 +28,10 @@ public:
   void Load();
   void LoadTheme();
 
+  // Re-read only the Enable...Hook keys ("e2r reload"). The other fields are
+  // read by the overlay and worker threads and are only loaded at startup.
+  void LoadHooks();
+
   // Get the resolved font file path based on current preset
   [[nodiscard]] std::string GetFontPath() const;
 
@@ -41,6 +45,10 @@ public:
   std::uint32_t controllerToggleButton =
       0x8000;                         // Y button on Xbox (0x8000 = 32768)
   float controllerScrollSpeed = 3.0f; // Scroll speed for controller thumbstick
+  std::uint32_t bookCacheSizeMB = 16; // Memory for processed books (LRU)
+  bool bookPrefetch = true; // Process books on crosshair/item selection
+  bool pageMode = false;    // Show one [pagebreak] page at a time
+  bool precompileBooks = false; // Process every book at data load
 
   // ---- Font ----
   FontPreset fontPreset = FontPreset::Sovngarde;
@@ -124,6 +132,11 @@ public:
   bool sanitizationDebugMode = false;
   bool sanitizationLogReplacements = false;
   float sanitizationMaxExpansionRatio = 3.0f;
+  bool sanitizationAuditReport = true; // DetectOnly: write Easy2Read_Audit.csv
+  bool sanitizationLatin1ToUTF8 = false; // Re-encode legacy Latin-1 as UTF-8
+  std::uint32_t sanitizationProfileSampleRate = 0; // Time 1 in N hook calls
+  bool sanitizationCapture = false; // Record hook input for e2r-replay
+  bool sanitizationPersistentCache = true; // Keep results across launches
 
   // ---- Per-hook enable settings ----
   bool hookEnableDescription = true;
@@ -0,0 +1,156 @@
+#include "BookPrefetch.h"
+#include "Config/Settings.h"
+#include "PCH.h"
+#include "Utils/BookLibrary.h"
+#include "Utils/BookUtils.h"
+
+namespace Easy2Read {
+
+namespace {
+
+bool IsItemMenu(const RE::BSFixedString &menuName) {
+  return menuName == RE::InventoryMenu::MENU_NAME ||
+         menuName == RE::ContainerMenu::MENU_NAME ||
+         menuName == RE::BarterMenu::MENU_NAME;
+}
+
+} // namespace
+
+BookPrefetch *BookPrefetch::GetSingleton() {
+  static BookPrefetch singleton;
+  return &singleton;
+}
+
+void BookPrefetch::Register() {
+  if (auto *crosshair = SKSE::GetCrosshairRefEventSource()) {
+    crosshair->AddEventSink(this);
+  }
+  if (auto *ui = RE::UI::GetSingleton()) {
+    ui->AddEventSink<RE::MenuOpenCloseEvent>(this);
+  }
+  if (auto *input = RE::BSInputDeviceManager::GetSingleton()) {
+    input->AddEventSink(this);
+  }
+  SKSE::log::info("BookPrefetch: Registered (up to {} books at once)",
+                  kMaxInFlight);
+}
+
+RE::BSEventNotifyControl BookPrefetch::ProcessEvent(
+    const SKSE::CrosshairRefEvent *a_event,
+    [[maybe_unused]] RE::BSTEventSource<SKSE::CrosshairRefEvent> *a_source) {
+  if (!a_event || !a_event->crosshairRef) {
+    return RE::BSEventNotifyControl::kContinue;
+  }
+  if (auto *base = a_event->crosshairRef->GetBaseObject()) {
+    Prefetch(base->As<RE::TESObjectBOOK>());
+  }
+  return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::BSEventNotifyControl BookPrefetch::ProcessEvent(
+    const RE::MenuOpenCloseEvent *a_event,
+    [[maybe_unused]] RE::BSTEventSource<RE::MenuOpenCloseEvent> *a_source) {
+  if (!a_event || !IsItemMenu(a_event->menuName)) {
+    return RE::BSEventNotifyControl::kContinue;
+  }
+
+  itemMenuOpen_ = a_event->opening;
+  if (a_event->opening) {
+    // The first item is selected without any input
+    Prefetch(GetSelectedMenuBook());
+  } else if (pending_) {
+    pending_->Cancel();
+    pending_.reset();
+  }
+  return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::BSEventNotifyControl BookPrefetch::ProcessEvent(
+    RE::InputEvent *const *a_event,
+    [[maybe_unused]] RE::BSTEventSource<RE::InputEvent *> *a_source) {
+  if (a_event && *a_event && itemMenuOpen_) {
+    Prefetch(GetSelectedMenuBook());
+  }
+  return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::TESObjectBOOK *BookPrefetch::GetSelectedMenuBook() const {
+  auto *ui = RE::UI::GetSingleton();
+  if (!ui) {
+    return nullptr;
+  }
+
+  RE::ItemList *itemList = nullptr;
+  if (auto menu = ui->GetMenu<RE::InventoryMenu>()) {
+    itemList = menu->GetRuntimeData().itemList;
+  } else if (auto container = ui->GetMenu<RE::ContainerMenu>()) {
+    itemList = container->GetRuntimeData().itemList;
+  } else if (auto barter = ui->GetMenu<RE::BarterMenu>()) {
+    itemList = barter->GetRuntimeData().itemList;
+  }
+
+  auto *item = itemList ? itemList->GetSelectedItem() : nullptr;
+  auto *entry = item ? item->data.objDesc : nullptr;
+  auto *object = entry ? entry->GetObject() : nullptr;
+  return object ? object->As<RE::TESObjectBOOK>() : nullptr;
+}
+
+void BookPrefetch::Prefetch(RE::TESObjectBOOK *a_book) {
+  if (!a_book || a_book->GetFormID() == lastBook_ ||
+      !Settings::GetSingleton()->overlayEnabled) {
+    return;
+  }
+  lastBook_ = a_book->GetFormID();
+
+  if (inFlight_.load(std::memory_order_relaxed) >= kMaxInFlight) {
+    skippedBusy_.fetch_add(1, std::memory_order_relaxed);
+    lastBook_ = 0; // Try again on the next event
+    return;
+  }
+
+  // Workers never touch forms: copy the text, title and cache key here
+  auto source = BookUtils::ReadBookSource(a_book);
+  if (!source) {
+    return;
+  }
+  if (BookCache::GetSingleton()->Contains(source->key) ||
+      BookLibrary::GetSingleton()->Contains(source->key)) {
+    alreadyCached_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Looking at something else makes the previous book unlikely to be read
+  if (pending_) {
+    pending_->Cancel();
+  }
+  pending_ = std::make_shared<CancellationToken>();
+
+  // The token is checked in the task rather than by the queue, so every
+  // submitted task runs and releases its in-flight slot
+  inFlight_.fetch_add(1, std::memory_order_relaxed);
+  queued_.fetch_add(1, std::memory_order_relaxed);
+  const bool submitted = TaskQueue::GetSingleton()->Submit(
+      [this, source = std::move(*source), token = pending_] {
+        if (!token->IsCancelled() &&
+            !BookCache::GetSingleton()->Contains(source.key)) {
+          BookUtils::BuildDocument(source);
+          processed_.fetch_add(1, std::memory_order_relaxed);
+        }
+        inFlight_.fetch_sub(1, std::memory_order_relaxed);
+      },
+      TaskPriority::Low);
+  if (!submitted) {
+    inFlight_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+void BookPrefetch::LogStats() const {
+  SKSE::log::info("BookPrefetch: {} books queued, {} processed ahead, "
+                  "{} already cached, {} skipped (busy)",
+                  queued_.load(std::memory_order_relaxed),
+                  processed_.load(std::memory_order_relaxed),
+                  alreadyCached_.load(std::memory_order_relaxed),
+                  skippedBusy_.load(std::memory_order_relaxed));
+}
+
+} // namespace Easy2Read
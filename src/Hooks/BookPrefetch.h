@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Utils/TaskQueue.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Easy2Read {
+
+/**
+ * Processes books speculatively before the BookMenu opens. When the crosshair
+ * lands on a book, or a book is selected in the inventory, container or
+ * barter menu, the book's text is copied on the game thread and run through
+ * the BookPipeline on a low-priority TaskQueue worker into the BookCache.
+ * Opening the book then usually finds its document ready.
+ *
+ * Only the latest target is worth finishing: each new target cancels the
+ * previous one if it hasn't started, and at most kMaxInFlight books are
+ * processed at once (further targets are skipped until one finishes).
+ */
+class BookPrefetch : public RE::BSTEventSink<SKSE::CrosshairRefEvent>,
+                     public RE::BSTEventSink<RE::MenuOpenCloseEvent>,
+                     public RE::BSTEventSink<RE::InputEvent *> {
+public:
+  [[nodiscard]] static BookPrefetch *GetSingleton();
+
+  void Register();
+
+  RE::BSEventNotifyControl
+  ProcessEvent(const SKSE::CrosshairRefEvent *a_event,
+               RE::BSTEventSource<SKSE::CrosshairRefEvent> *a_source) override;
+
+  RE::BSEventNotifyControl
+  ProcessEvent(const RE::MenuOpenCloseEvent *a_event,
+               RE::BSTEventSource<RE::MenuOpenCloseEvent> *a_source) override;
+
+  // Selection in item menus changes through input; checked after each event
+  RE::BSEventNotifyControl
+  ProcessEvent(RE::InputEvent *const *a_event,
+               RE::BSTEventSource<RE::InputEvent *> *a_source) override;
+
+  void LogStats() const;
+
+private:
+  BookPrefetch() = default;
+  BookPrefetch(const BookPrefetch &) = delete;
+  BookPrefetch(BookPrefetch &&) = delete;
+  ~BookPrefetch() override = default;
+  BookPrefetch &operator=(const BookPrefetch &) = delete;
+  BookPrefetch &operator=(BookPrefetch &&) = delete;
+
+  static constexpr std::uint32_t kMaxInFlight = 2;
+
+  // Book selected in the open item menu, if any (game thread)
+  [[nodiscard]] RE::TESObjectBOOK *GetSelectedMenuBook() const;
+
+  // Copy the book's text and queue it (game thread)
+  void Prefetch(RE::TESObjectBOOK *a_book);
+
+  // Game-thread state (all three event sources send on the main thread)
+  RE::FormID lastBook_ = 0;
+  CancellationTokenPtr pending_;
+  bool itemMenuOpen_ = false;
+
+  std::atomic<std::uint32_t> inFlight_{0};
+  std::atomic<std::uint64_t> queued_{0};
+  std::atomic<std::uint64_t> processed_{0};
+  std::atomic<std::uint64_t> alreadyCached_{0};
+  std::atomic<std::uint64_t> skippedBusy_{0};
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,168 @@
+#include "ConsoleCommands.h"
+#include "Config/Settings.h"
+#include "HookProfiler.h"
+#include "NameTable.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+namespace {
+// Unused developer command that is repurposed
+constexpr auto kReplacedCommand = "TestSeenData"sv;
+
+constexpr auto kHelp = "Easy2Read: e2r profile [reset] | hooks | "
+                       "<hook> <off|detect|on> | reload"sv;
+
+// Hooks whose text NameTable rewrites on the forms themselves
+bool IsNameHook(TextHook a_hook) {
+  return a_hook == TextHook::NpcName || a_hook == TextHook::MapMarker;
+}
+} // namespace
+
+void ConsoleCommands::Install() {
+  auto *command =
+      RE::SCRIPT_FUNCTION::LocateConsoleCommand(kReplacedCommand);
+  if (!command) {
+    SKSE::log::warn("ConsoleCommands: {} not found, e2r command unavailable",
+                    kReplacedCommand);
+    return;
+  }
+
+  static RE::SCRIPT_PARAMETER params[] = {
+      {"Command", RE::SCRIPT_PARAM_TYPE::kChar, false},
+      {"Argument", RE::SCRIPT_PARAM_TYPE::kChar, true},
+  };
+
+  command->functionName = "Easy2Read";
+  command->shortName = "e2r";
+  command->helpString = kHelp.data();
+  command->referenceFunction = false;
+  command->SetParameters(params);
+  command->executeFunction = &Execute;
+  command->conditionFunction = nullptr;
+
+  SKSE::log::info("ConsoleCommands: Registered e2r (replaces {})",
+                  kReplacedCommand);
+}
+
+bool ConsoleCommands::Execute(const RE::SCRIPT_PARAMETER *a_paramInfo,
+                              RE::SCRIPT_FUNCTION::ScriptData *a_scriptData,
+                              RE::TESObjectREFR *a_thisObj,
+                              RE::TESObjectREFR *a_containingObj,
+                              RE::Script *a_scriptObj,
+                              RE::ScriptLocals *a_locals,
+                              [[maybe_unused]] double &a_result,
+                              std::uint32_t &a_opcodeOffsetPtr) {
+  char command[64]{};
+  char argument[64]{};
+  RE::SCRIPT_FUNCTION::ParseParameters(a_paramInfo, a_scriptData,
+                                       a_opcodeOffsetPtr, a_thisObj,
+                                       a_containingObj, a_scriptObj, a_locals,
+                                       command, argument);
+
+  if (_stricmp(command, "profile") == 0) {
+    auto *profiler = HookProfiler::GetSingleton();
+    if (_stricmp(argument, "reset") == 0) {
+      profiler->Reset();
+      Print("Easy2Read: hook profile reset");
+      return true;
+    }
+    for (const auto &line : profiler->Report()) {
+      Print(line);
+    }
+    profiler->LogReport();
+    return true;
+  }
+
+  auto *registry = HookRegistry::GetSingleton();
+  if (_stricmp(command, "hooks") == 0) {
+    for (const auto &line : registry->Report()) {
+      Print(line);
+    }
+    return true;
+  }
+
+  if (_stricmp(command, "reload") == 0) {
+    // Only the hook keys; the rest of Settings is read by other threads
+    const auto npcName = registry->GetPolicy(TextHook::NpcName);
+    const auto mapMarker = registry->GetPolicy(TextHook::MapMarker);
+    Settings::GetSingleton()->LoadHooks();
+    registry->LoadFromSettings();
+    KeepReplacedNames(TextHook::NpcName, npcName);
+    KeepReplacedNames(TextHook::MapMarker, mapMarker);
+    ApplyNameTable((std::max)(registry->GetPolicy(TextHook::NpcName),
+                              registry->GetPolicy(TextHook::MapMarker)));
+    for (const auto &line : registry->Report()) {
+      Print(line);
+    }
+    return true;
+  }
+
+  if (const auto hook = HookRegistry::ParseHook(command)) {
+    const auto policy = HookRegistry::ParsePolicy(argument);
+    if (!policy) {
+      Print(fmt::format("Easy2Read: {} is {}", HookRegistry::GetHookKey(*hook),
+                        GetHookPolicyName(registry->GetPolicy(*hook))));
+      return true;
+    }
+    if (!registry->IsBound(*hook)) {
+      Print(fmt::format("Easy2Read: {} is not installed (enable it in the INI "
+                        "and restart)",
+                        HookRegistry::GetHookKey(*hook)));
+      return true;
+    }
+    if (IsNameHook(*hook) &&
+        registry->GetPolicy(*hook) == HookPolicy::Replace &&
+        *policy != HookPolicy::Replace) {
+      Print(fmt::format("Easy2Read: {} names are already replaced; restart to "
+                        "switch the hook off",
+                        HookRegistry::GetHookKey(*hook)));
+      return true;
+    }
+
+    const auto applied = registry->SetPolicy(*hook, *policy);
+    Print(fmt::format("Easy2Read: {} set to {}{}",
+                      HookRegistry::GetHookKey(*hook),
+                      GetHookPolicyName(applied),
+                      applied != *policy ? " (limited by Mode)" : ""));
+    if (IsNameHook(*hook)) {
+      ApplyNameTable(applied);
+    }
+    return true;
+  }
+
+  Print(kHelp);
+  return true;
+}
+
+void ConsoleCommands::KeepReplacedNames(TextHook a_hook,
+                                        HookPolicy a_previous) {
+  // Rewritten names can't be restored, so the hook keeps reporting them
+  auto *registry = HookRegistry::GetSingleton();
+  if (a_previous == HookPolicy::Replace &&
+      registry->GetPolicy(a_hook) != HookPolicy::Replace) {
+    registry->SetPolicy(a_hook, HookPolicy::Replace);
+    Print(fmt::format("Easy2Read: {} names are already replaced; restart to "
+                      "switch the hook off",
+                      HookRegistry::GetHookKey(a_hook)));
+  }
+}
+
+void ConsoleCommands::ApplyNameTable(HookPolicy a_policy) {
+  if (a_policy != HookPolicy::Replace) {
+    return;
+  }
+  // Names already clean are skipped, so repeating the pass is cheap
+  const auto stats = NameTable::Apply();
+  if (stats.rewritten > 0) {
+    Print(fmt::format("Easy2Read: replaced {} names", stats.rewritten));
+  }
+}
+
+void ConsoleCommands::Print(std::string_view a_line) {
+  if (auto *console = RE::ConsoleLog::GetSingleton()) {
+    console->Print("%s", std::string(a_line).c_str());
+  }
+}
+
+} // namespace Easy2Read
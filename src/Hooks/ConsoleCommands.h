@@ -0,0 +1,40 @@
+#pragma once
+
+#include "HookRegistry.h"
+
+namespace Easy2Read {
+
+/**
+ * The "Easy2Read" (short: "e2r") console command.
+ * Takes over an unused developer command, as SKSE provides no way to add new
+ * ones. Subcommands:
+ *   e2r profile        - print hook latency percentiles
+ *   e2r profile reset  - clear the latency histograms
+ *   e2r hooks          - list hook policies and counters
+ *   e2r <hook> <off|detect|on> - switch one hook at runtime
+ *   e2r reload         - re-read Easy2Read.ini and apply its hook settings
+ * Only hooks installed at data load can be switched. Once NPC or map marker
+ * names have been replaced, their hooks can't be switched back off.
+ */
+class ConsoleCommands {
+public:
+  static void Install();
+
+private:
+  static bool Execute(const RE::SCRIPT_PARAMETER *a_paramInfo,
+                      RE::SCRIPT_FUNCTION::ScriptData *a_scriptData,
+                      RE::TESObjectREFR *a_thisObj,
+                      RE::TESObjectREFR *a_containingObj,
+                      RE::Script *a_scriptObj, RE::ScriptLocals *a_locals,
+                      double &a_result, std::uint32_t &a_opcodeOffsetPtr);
+
+  static void Print(std::string_view a_line);
+
+  // Replace NPC and map marker names after a name hook is switched on
+  static void ApplyNameTable(HookPolicy a_policy);
+
+  // Undo a reload that would switch off a name hook whose names are replaced
+  static void KeepReplacedNames(TextHook a_hook, HookPolicy a_previous);
+};
+
+} // namespace Easy2Read
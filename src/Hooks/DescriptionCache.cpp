@@ -0,0 +1,79 @@
+#include "DescriptionCache.h"
+#include "PCH.h"
+#include "Utils/Hash.h"
+
+namespace Easy2Read {
+
+DescriptionCache *DescriptionCache::GetSingleton() {
+  static DescriptionCache singleton;
+  return &singleton;
+}
+
+std::size_t DescriptionCache::KeyHash::operator()(const Key &key) const {
+  auto hash = static_cast<std::uint64_t>(
+      reinterpret_cast<std::uintptr_t>(key.description));
+  hash = HashCombine(hash, key.parentFormID);
+  hash = HashCombine(hash, key.chunkID);
+  return static_cast<std::size_t>(hash);
+}
+
+std::optional<std::string_view>
+DescriptionCache::Lookup(const Key &key, std::uint64_t sourceHash) {
+  lookups_.fetch_add(1, std::memory_order_relaxed);
+
+  std::shared_lock lock(lock_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return std::nullopt;
+  }
+
+  if (it->second.sourceHash != sourceHash) {
+    invalidations_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  savedNanoseconds_.fetch_add(it->second.sanitizeNanoseconds,
+                              std::memory_order_relaxed);
+  return it->second.sanitized;
+}
+
+void DescriptionCache::Store(const Key &key, std::uint64_t sourceHash,
+                             std::string_view sanitized,
+                             std::uint64_t sanitizeNanoseconds) {
+  std::unique_lock lock(lock_);
+  if (entries_.size() >= kMaxEntries && !entries_.contains(key)) {
+    SKSE::log::debug("DescriptionCache: Reached {} entries, clearing",
+                     kMaxEntries);
+    entries_.clear();
+  }
+  entries_[key] = Entry{sourceHash, sanitized, sanitizeNanoseconds};
+}
+
+DescriptionCache::Stats DescriptionCache::GetStats() const {
+  Stats stats;
+  stats.lookups = lookups_.load(std::memory_order_relaxed);
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.invalidations = invalidations_.load(std::memory_order_relaxed);
+  stats.savedMicroseconds =
+      savedNanoseconds_.load(std::memory_order_relaxed) / 1000;
+  {
+    std::shared_lock lock(lock_);
+    stats.entries = entries_.size();
+  }
+  return stats;
+}
+
+void DescriptionCache::LogStats() const {
+  const auto stats = GetStats();
+  const double hitRatio =
+      stats.lookups > 0 ? 100.0 * static_cast<double>(stats.hits) /
+                              static_cast<double>(stats.lookups)
+                        : 0.0;
+  SKSE::log::info("DescriptionCache: {} entries, {} hits / {} lookups "
+                  "({:.1f}%), {} invalidated, {} us sanitizer time saved",
+                  stats.entries, stats.hits, stats.lookups, hitRatio,
+                  stats.invalidations, stats.savedMicroseconds);
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace RE {
+class TESDescription;
+}
+
+namespace Easy2Read {
+
+/**
+ * Cache of sanitized TESDescription::GetDescription results.
+ * Entries are keyed by (description, parent form, chunk) and validated against
+ * a hash of the original function's output, so text changed by Dynamic String
+ * Distributor or other chained hooks invalidates the entry automatically.
+ * Sanitized text lives in the StringPool.
+ */
+class DescriptionCache {
+public:
+  struct Key {
+    const RE::TESDescription *description;
+    std::uint32_t parentFormID;
+    std::uint32_t chunkID;
+
+    bool operator==(const Key &) const = default;
+  };
+
+  struct Stats {
+    std::uint64_t lookups = 0;
+    std::uint64_t hits = 0;
+    std::uint64_t invalidations = 0; // Entry found but source text changed
+    std::uint64_t entries = 0;
+    std::uint64_t savedMicroseconds = 0; // Sanitizer time avoided by hits
+  };
+
+  [[nodiscard]] static DescriptionCache *GetSingleton();
+
+  /**
+   * Find the cached sanitized text for a description.
+   * @param key Description identity
+   * @param sourceHash HashText() of the original (unsanitized) output
+   * @return The sanitized text, or nullopt on miss or stale entry
+   */
+  [[nodiscard]] std::optional<std::string_view> Lookup(const Key &key,
+                                                       std::uint64_t sourceHash);
+
+  /**
+   * Remember the sanitized text for a description.
+   * @param sanitized Pooled sanitized text (must outlive the cache)
+   * @param sanitizeNanoseconds Time the sanitizer took to produce it
+   */
+  void Store(const Key &key, std::uint64_t sourceHash,
+             std::string_view sanitized, std::uint64_t sanitizeNanoseconds);
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  DescriptionCache() = default;
+  ~DescriptionCache() = default;
+  DescriptionCache(const DescriptionCache &) = delete;
+  DescriptionCache(DescriptionCache &&) = delete;
+  DescriptionCache &operator=(const DescriptionCache &) = delete;
+  DescriptionCache &operator=(DescriptionCache &&) = delete;
+
+  // Upper bound on cached descriptions; the table is cleared when reached
+  static constexpr std::size_t kMaxEntries = 1 << 16;
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    std::uint64_t sourceHash;
+    std::string_view sanitized;
+    std::uint64_t sanitizeNanoseconds;
+  };
+
+  mutable std::shared_mutex lock_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+
+  std::atomic<std::uint64_t> lookups_{0};
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> invalidations_{0};
+  std::atomic<std::uint64_t> savedNanoseconds_{0};
+};
+
+} // namespace Easy2Read
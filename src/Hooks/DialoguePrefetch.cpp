@@ -0,0 +1,146 @@
+#include "DialoguePrefetch.h"
+#include "HookRegistry.h"
+#include "PCH.h"
+#include "TextSanitization/SanitizedTextCache.h"
+
+namespace Easy2Read {
+
+DialoguePrefetch *DialoguePrefetch::GetSingleton() {
+  static DialoguePrefetch singleton;
+  return &singleton;
+}
+
+void DialoguePrefetch::Register() {
+  if (auto *dataHandler = RE::TESDataHandler::GetSingleton()) {
+    for (const auto *topic : dataHandler->GetFormArray<RE::TESTopic>()) {
+      if (topic && topic->ownerQuest) {
+        topicsByQuest_[topic->ownerQuest].push_back(topic);
+      }
+    }
+  }
+
+  if (auto *ui = RE::UI::GetSingleton()) {
+    ui->AddEventSink<RE::MenuOpenCloseEvent>(this);
+  }
+  if (auto *events = RE::ScriptEventSourceHolder::GetSingleton()) {
+    events->AddEventSink<RE::TESTopicInfoEvent>(this);
+  }
+
+  SKSE::log::info("DialoguePrefetch: Registered ({} quests with topics)",
+                  topicsByQuest_.size());
+}
+
+RE::BSEventNotifyControl DialoguePrefetch::ProcessEvent(
+    const RE::MenuOpenCloseEvent *a_event,
+    [[maybe_unused]] RE::BSTEventSource<RE::MenuOpenCloseEvent> *a_source) {
+  if (a_event && a_event->menuName == RE::DialogueMenu::MENU_NAME) {
+    if (a_event->opening) {
+      BeginConversation();
+    } else {
+      EndConversation();
+    }
+  }
+  return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::BSEventNotifyControl DialoguePrefetch::ProcessEvent(
+    const RE::TESTopicInfoEvent *a_event,
+    [[maybe_unused]] RE::BSTEventSource<RE::TESTopicInfoEvent> *a_source) {
+  // Only the player's conversation; scenes between NPCs have no menu
+  if (!a_event || !conversation_ ||
+      a_event->type != RE::TESTopicInfoEvent::TopicInfoEventType::kTopicBegin) {
+    return RE::BSEventNotifyControl::kContinue;
+  }
+
+  // The next menu list most likely comes from the quest of the topic just said
+  const auto *info =
+      RE::TESForm::LookupByID<RE::TESTopicInfo>(a_event->topicInfoFormID);
+  if (info && info->parentTopic) {
+    PrefetchQuest(info->parentTopic->ownerQuest, TaskPriority::High);
+  }
+  return RE::BSEventNotifyControl::kContinue;
+}
+
+void DialoguePrefetch::BeginConversation() {
+  EndConversation();
+  // Nothing to warm unless the menu hook replaces text
+  if (HookRegistry::GetSingleton()->GetPolicy(TextHook::DialogueMenu) !=
+      HookPolicy::Replace) {
+    return;
+  }
+  conversation_ = std::make_shared<CancellationToken>();
+
+  auto *topicManager = RE::MenuTopicManager::GetSingleton();
+  if (!topicManager || !topicManager->dialogueList) {
+    return;
+  }
+
+  for (const auto *dialogue : *topicManager->dialogueList) {
+    if (dialogue && dialogue->parentTopic) {
+      PrefetchQuest(dialogue->parentTopic->ownerQuest, TaskPriority::Normal);
+    }
+  }
+}
+
+void DialoguePrefetch::EndConversation() {
+  if (conversation_) {
+    conversation_->Cancel();
+    conversation_.reset();
+    cancelledConversations_.fetch_add(1, std::memory_order_relaxed);
+  }
+  prefetchedQuests_.clear();
+}
+
+void DialoguePrefetch::PrefetchQuest(const RE::TESQuest *a_quest,
+                                     TaskPriority a_priority) {
+  if (!a_quest || !conversation_ || !prefetchedQuests_.insert(a_quest).second) {
+    return;
+  }
+
+  auto it = topicsByQuest_.find(a_quest);
+  if (it == topicsByQuest_.end()) {
+    return;
+  }
+
+  // Copy the names here; workers never touch forms
+  std::vector<std::string> texts;
+  texts.reserve(it->second.size());
+  for (const auto *topic : it->second) {
+    const char *name = topic->GetFullName();
+    if (name && name[0] != '\0') {
+      texts.emplace_back(name);
+    }
+  }
+  if (texts.empty()) {
+    return;
+  }
+
+  queuedTexts_.fetch_add(texts.size(), std::memory_order_relaxed);
+  TaskQueue::GetSingleton()->Submit(
+      [texts = std::move(texts), token = conversation_] {
+        SanitizeBatch(texts, *token);
+      },
+      a_priority, conversation_);
+}
+
+void DialoguePrefetch::SanitizeBatch(const std::vector<std::string> &a_texts,
+                                     const CancellationToken &a_token) {
+  auto *results = SanitizedTextCache::GetSingleton();
+  for (const auto &text : a_texts) {
+    if (a_token.IsCancelled()) {
+      return;
+    }
+    results->Prefetch(text);
+  }
+}
+
+void DialoguePrefetch::LogStats() const {
+  const auto stats = TaskQueue::GetSingleton()->GetStats();
+  SKSE::log::info("DialoguePrefetch: {} topic names queued, {} conversations; "
+                  "TaskQueue {} tasks done, {} cancelled",
+                  queuedTexts_.load(std::memory_order_relaxed),
+                  cancelledConversations_.load(std::memory_order_relaxed),
+                  stats.completed, stats.cancelled);
+}
+
+} // namespace Easy2Read
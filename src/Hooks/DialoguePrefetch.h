@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Utils/TaskQueue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Easy2Read {
+
+/**
+ * Sanitizes dialogue menu text ahead of time on a worker thread.
+ * When the DialogueMenu opens, and whenever a topic is said, the topic names
+ * (DIAL FULL) of the quests involved are copied and queued to the TaskQueue.
+ * Results go into the SanitizedTextCache, so DialogueMenuTextHook only does a
+ * lookup when the menu rebuilds its list. Queued work is cancelled when the
+ * conversation ends.
+ *
+ * INFO text can't be read ahead: a TESTopicInfo only keeps the file offset
+ * of its record, and the game reads the response (NAM1) and prompt (RNAM)
+ * from the plugin, through the string tables for localized plugins, only
+ * while it builds the response or the menu's option list. The hooks see them
+ * at that same moment, so both are cached by content on first use instead.
+ */
+class DialoguePrefetch : public RE::BSTEventSink<RE::MenuOpenCloseEvent>,
+                         public RE::BSTEventSink<RE::TESTopicInfoEvent> {
+public:
+  [[nodiscard]] static DialoguePrefetch *GetSingleton();
+
+  // Index topics by quest and register for menu and topic events
+  void Register();
+
+  RE::BSEventNotifyControl
+  ProcessEvent(const RE::MenuOpenCloseEvent *a_event,
+               RE::BSTEventSource<RE::MenuOpenCloseEvent> *a_source) override;
+
+  RE::BSEventNotifyControl
+  ProcessEvent(const RE::TESTopicInfoEvent *a_event,
+               RE::BSTEventSource<RE::TESTopicInfoEvent> *a_source) override;
+
+  void LogStats() const;
+
+private:
+  DialoguePrefetch() = default;
+  DialoguePrefetch(const DialoguePrefetch &) = delete;
+  DialoguePrefetch(DialoguePrefetch &&) = delete;
+  ~DialoguePrefetch() override = default;
+  DialoguePrefetch &operator=(const DialoguePrefetch &) = delete;
+  DialoguePrefetch &operator=(DialoguePrefetch &&) = delete;
+
+  void BeginConversation();
+  void EndConversation();
+
+  // Copy the topic names of a quest and queue them (game thread)
+  void PrefetchQuest(const RE::TESQuest *a_quest, TaskPriority a_priority);
+
+  // Worker: sanitize a batch into the SanitizedTextCache
+  static void SanitizeBatch(const std::vector<std::string> &a_texts,
+                            const CancellationToken &a_token);
+
+  // Game-thread state (menu and topic events are sent on the main thread)
+  std::unordered_map<const RE::TESQuest *, std::vector<const RE::TESTopic *>>
+      topicsByQuest_;
+  std::unordered_set<const RE::TESQuest *> prefetchedQuests_;
+  CancellationTokenPtr conversation_;
+
+  std::atomic<std::uint64_t> queuedTexts_{0};
+  std::atomic<std::uint64_t> cancelledConversations_{0};
+};
+
+} // namespace Easy2Read
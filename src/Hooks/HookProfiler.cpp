@@ -0,0 +1,166 @@
+#include "HookProfiler.h"
+#include "PCH.h"
+#include <bit>
+
+namespace Easy2Read {
+
+HookProfiler *HookProfiler::GetSingleton() {
+  static HookProfiler singleton;
+  return &singleton;
+}
+
+HookProfiler::HookProfiler()
+    : startTicks_(ReadTicks()), startTime_(std::chrono::steady_clock::now()) {}
+
+void HookProfiler::SetSampleRate(std::uint32_t rate) {
+  sampleRate_.store(rate, std::memory_order_relaxed);
+  if (rate != 0) {
+    SKSE::log::info("HookProfiler: Timing 1 of every {} hook calls", rate);
+  }
+}
+
+bool HookProfiler::ShouldSample() const {
+  const auto rate = sampleRate_.load(std::memory_order_relaxed);
+  if (rate == 0) {
+    return false;
+  }
+  thread_local std::uint32_t counter = 0;
+  if (++counter < rate) {
+    return false;
+  }
+  counter = 0;
+  return true;
+}
+
+HookProfiler::Sample::Sample(TextHook hook) : hook_(hook) {
+  if (GetSingleton()->ShouldSample()) {
+    active_ = true;
+    start_ = ReadTicks();
+    split_ = start_;
+  }
+}
+
+HookProfiler::Sample::~Sample() {
+  if (!active_) {
+    return;
+  }
+  const auto end = ReadTicks();
+  auto *profiler = GetSingleton();
+  profiler->Record(hook_, HookPhase::Total, end - start_);
+  profiler->Record(hook_, HookPhase::Original, split_ - start_);
+  profiler->Record(hook_, HookPhase::Sanitizer, end - split_);
+}
+
+void HookProfiler::Record(TextHook hook, HookPhase phase,
+                          std::uint64_t ticks) {
+  histograms_[static_cast<std::size_t>(hook)][static_cast<std::size_t>(phase)]
+      .Record(ticks);
+}
+
+void HookProfiler::Histogram::Record(std::uint64_t ticks) {
+  const auto bucket =
+      std::min<std::size_t>(std::bit_width(ticks), kBucketCount - 1);
+  buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  count.fetch_add(1, std::memory_order_relaxed);
+
+  auto current = max.load(std::memory_order_relaxed);
+  while (ticks > current &&
+         !max.compare_exchange_weak(current, ticks,
+                                    std::memory_order_relaxed)) {
+  }
+}
+
+void HookProfiler::Histogram::Reset() {
+  for (auto &bucket : buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count.store(0, std::memory_order_relaxed);
+  max.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t HookProfiler::Histogram::Percentile(double fraction) const {
+  std::uint64_t total = 0;
+  for (const auto &bucket : buckets) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  const auto target =
+      static_cast<std::uint64_t>(fraction * static_cast<double>(total - 1)) +
+      1;
+  std::uint64_t seen = 0;
+  for (std::size_t b = 0; b < kBucketCount; ++b) {
+    seen += buckets[b].load(std::memory_order_relaxed);
+    if (seen >= target) {
+      // Don't report more than the largest sample actually seen
+      const std::uint64_t upper = b == 0 ? 0 : (1ull << b) - 1;
+      return std::min(upper, max.load(std::memory_order_relaxed));
+    }
+  }
+  return max.load(std::memory_order_relaxed);
+}
+
+void HookProfiler::Reset() {
+  for (auto &hook : histograms_) {
+    for (auto &histogram : hook) {
+      histogram.Reset();
+    }
+  }
+}
+
+double HookProfiler::TicksPerMicrosecond() const {
+  const auto ticks = ReadTicks() - startTicks_;
+  const auto elapsed = std::chrono::duration<double, std::micro>(
+                           std::chrono::steady_clock::now() - startTime_)
+                           .count();
+  return elapsed > 0.0 ? static_cast<double>(ticks) / elapsed : 1.0;
+}
+
+std::vector<std::string> HookProfiler::Report() const {
+  std::vector<std::string> lines;
+  const double ticksPerUs = TicksPerMicrosecond();
+  auto us = [ticksPerUs](std::uint64_t ticks) {
+    return static_cast<double>(ticks) / ticksPerUs;
+  };
+
+  static constexpr std::array<const char *, kPhaseCount> kPhaseNames = {
+      "total", "original", "sanitizer"};
+
+  for (std::size_t h = 0; h < kHookCount; ++h) {
+    const auto &phases = histograms_[h];
+    const auto samples =
+        phases[static_cast<std::size_t>(HookPhase::Total)].count.load(
+            std::memory_order_relaxed);
+    if (samples == 0) {
+      continue;
+    }
+
+    std::string line = fmt::format(
+        "{}: {} samples", GetTextHookLabel(static_cast<TextHook>(h)), samples);
+    for (std::size_t p = 0; p < kPhaseCount; ++p) {
+      const auto &histogram = phases[p];
+      line += fmt::format(
+          " | {} p50 {:.2f}us p99 {:.2f}us max {:.2f}us", kPhaseNames[p],
+          us(histogram.Percentile(0.50)), us(histogram.Percentile(0.99)),
+          us(histogram.max.load(std::memory_order_relaxed)));
+    }
+    lines.push_back(std::move(line));
+  }
+
+  if (lines.empty()) {
+    lines.emplace_back(IsEnabled()
+                           ? "no samples yet"
+                           : "profiling is off (set ProfileSampleRate)");
+  }
+  return lines;
+}
+
+void HookProfiler::LogReport() const {
+  for (const auto &line : Report()) {
+    SKSE::log::info("HookProfiler: {}", line);
+  }
+}
+
+} // namespace Easy2Read
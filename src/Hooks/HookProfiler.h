@@ -0,0 +1,119 @@
+#pragma once
+
+#include "TextSanitization/TextSanitizer.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace Easy2Read {
+
+// Part of a detour being timed
+enum class HookPhase : std::uint8_t {
+  Total,     // Whole detour
+  Original,  // Original function (or next hook in the chain)
+  Sanitizer, // Our work after the original returns
+  kTotal
+};
+
+/**
+ * Sampled latency histograms for the text hooks.
+ * A sampled call reads the TSC at entry, after the original function and at
+ * exit; the deltas go into lock-free log2-bucketed histograms per hook and
+ * phase. With a sample rate of 0 the only cost per call is one load and a
+ * branch.
+ */
+class HookProfiler {
+public:
+  [[nodiscard]] static HookProfiler *GetSingleton();
+
+  /**
+   * Set how often calls are timed.
+   * @param rate Time one of every `rate` calls per thread (0 = off)
+   */
+  void SetSampleRate(std::uint32_t rate);
+  [[nodiscard]] bool IsEnabled() const {
+    return sampleRate_.load(std::memory_order_relaxed) != 0;
+  }
+
+  // Clear all histograms
+  void Reset();
+
+  // Per-hook summary lines (p50/p99/max per phase), for the log and console
+  [[nodiscard]] std::vector<std::string> Report() const;
+  void LogReport() const;
+
+  [[nodiscard]] static std::uint64_t ReadTicks() { return __rdtsc(); }
+
+  /**
+   * Times one detour call if it is selected for sampling.
+   * Construct on entry, call OriginalDone() when the original returns.
+   */
+  class Sample {
+  public:
+    explicit Sample(TextHook hook);
+    ~Sample();
+    Sample(const Sample &) = delete;
+    Sample &operator=(const Sample &) = delete;
+
+    void OriginalDone() {
+      if (active_) {
+        split_ = ReadTicks();
+      }
+    }
+
+  private:
+    TextHook hook_;
+    bool active_ = false;
+    std::uint64_t start_ = 0;
+    std::uint64_t split_ = 0;
+  };
+
+private:
+  HookProfiler();
+  ~HookProfiler() = default;
+  HookProfiler(const HookProfiler &) = delete;
+  HookProfiler(HookProfiler &&) = delete;
+  HookProfiler &operator=(const HookProfiler &) = delete;
+  HookProfiler &operator=(HookProfiler &&) = delete;
+
+  static constexpr std::size_t kBucketCount = 64;
+  static constexpr auto kHookCount = static_cast<std::size_t>(TextHook::kTotal);
+  static constexpr auto kPhaseCount =
+      static_cast<std::size_t>(HookPhase::kTotal);
+
+  // Bucket b counts samples of [2^(b-1), 2^b) ticks
+  struct Histogram {
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets{};
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> max{0};
+
+    void Record(std::uint64_t ticks);
+    void Reset();
+    // Upper bound (in ticks) of the bucket holding the given percentile
+    [[nodiscard]] std::uint64_t Percentile(double fraction) const;
+  };
+
+  [[nodiscard]] bool ShouldSample() const;
+  void Record(TextHook hook, HookPhase phase, std::uint64_t ticks);
+
+  // Ticks per microsecond, measured against steady_clock since startup
+  [[nodiscard]] double TicksPerMicrosecond() const;
+
+  std::atomic<std::uint32_t> sampleRate_{0};
+  std::array<std::array<Histogram, kPhaseCount>, kHookCount> histograms_;
+
+  std::uint64_t startTicks_;
+  std::chrono::steady_clock::time_point startTime_;
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,169 @@
+#include "HookRegistry.h"
+#include "Config/Settings.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+std::string_view GetHookPolicyName(HookPolicy policy) {
+  switch (policy) {
+  case HookPolicy::PassThrough:
+    return "off";
+  case HookPolicy::DetectOnly:
+    return "detect";
+  case HookPolicy::Replace:
+    return "on";
+  }
+  return "?";
+}
+
+HookRegistry *HookRegistry::GetSingleton() {
+  static HookRegistry singleton;
+  return &singleton;
+}
+
+namespace {
+// Console/INI key for each hook, indexed by TextHook
+constexpr std::array<std::string_view, static_cast<std::size_t>(
+                                           TextHook::kTotal)>
+    kHookKeys = {"description", "dialogue", "dialoguemenu",
+                 "quest",       "mapmarker", "npcname"};
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+  return a.size() == b.size() &&
+         std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+           return std::tolower(static_cast<unsigned char>(x)) ==
+                  std::tolower(static_cast<unsigned char>(y));
+         });
+}
+} // namespace
+
+std::optional<TextHook> HookRegistry::ParseHook(std::string_view key) {
+  for (std::size_t i = 0; i < kHookKeys.size(); ++i) {
+    if (EqualsIgnoreCase(key, kHookKeys[i])) {
+      return static_cast<TextHook>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+std::string_view HookRegistry::GetHookKey(TextHook hook) {
+  const auto index = Index(hook);
+  return index < kHookKeys.size() ? kHookKeys[index] : "?"sv;
+}
+
+std::optional<HookPolicy> HookRegistry::ParsePolicy(std::string_view name) {
+  if (EqualsIgnoreCase(name, "off") || EqualsIgnoreCase(name, "pass")) {
+    return HookPolicy::PassThrough;
+  }
+  if (EqualsIgnoreCase(name, "detect")) {
+    return HookPolicy::DetectOnly;
+  }
+  if (EqualsIgnoreCase(name, "on") || EqualsIgnoreCase(name, "replace")) {
+    return HookPolicy::Replace;
+  }
+  return std::nullopt;
+}
+
+HookPolicy HookRegistry::MaxPolicy() {
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  if (!sanitizer->IsEnabled()) {
+    return HookPolicy::PassThrough;
+  }
+  switch (sanitizer->GetMode()) {
+  case SanitizationMode::Off:
+    return HookPolicy::PassThrough;
+  case SanitizationMode::DetectOnly:
+    return HookPolicy::DetectOnly;
+  default:
+    return HookPolicy::Replace;
+  }
+}
+
+void HookRegistry::Bind(TextHook hook, Selector selector) {
+  std::lock_guard lock(lock_);
+  auto &entry = entries_[Index(hook)];
+  entry.selector.store(selector, std::memory_order_release);
+  selector(entry.policy.load(std::memory_order_relaxed));
+}
+
+bool HookRegistry::IsBound(TextHook hook) const {
+  return entries_[Index(hook)].selector.load(std::memory_order_acquire) !=
+         nullptr;
+}
+
+void HookRegistry::Seal() {
+  std::lock_guard lock(lock_);
+  sealed_ = true;
+  for (auto &entry : entries_) {
+    if (!entry.selector.load(std::memory_order_relaxed)) {
+      entry.policy.store(HookPolicy::PassThrough, std::memory_order_relaxed);
+    }
+  }
+}
+
+HookPolicy HookRegistry::SetPolicy(TextHook hook, HookPolicy policy) {
+  policy = (std::min)(policy, MaxPolicy());
+
+  std::lock_guard lock(lock_);
+  auto &entry = entries_[Index(hook)];
+  if (sealed_ && !entry.selector.load(std::memory_order_relaxed)) {
+    return entry.policy.load(std::memory_order_relaxed);
+  }
+  if (entry.policy.exchange(policy, std::memory_order_relaxed) != policy) {
+    SKSE::log::info("HookRegistry: {} hook set to {}", GetHookKey(hook),
+                    GetHookPolicyName(policy));
+  }
+  if (auto selector = entry.selector.load(std::memory_order_relaxed)) {
+    selector(policy);
+  }
+  return policy;
+}
+
+void HookRegistry::LoadFromSettings() {
+  const auto *settings = Settings::GetSingleton();
+
+  HookSettings hooks;
+  hooks.enableDescription = settings->hookEnableDescription;
+  hooks.enableDialogue = settings->hookEnableDialogue;
+  hooks.enableDialogueMenu = settings->hookEnableDialogueMenu;
+  hooks.enableQuest = settings->hookEnableQuest;
+  hooks.enableMapMarker = settings->hookEnableMapMarker;
+  hooks.enableNpcName = settings->hookEnableNpcName;
+  TextSanitizer::GetSingleton()->SetHookSettings(hooks);
+
+  const auto policyFor = [](bool enabled) {
+    return enabled ? HookPolicy::Replace : HookPolicy::PassThrough;
+  };
+  SetPolicy(TextHook::Description, policyFor(hooks.enableDescription));
+  SetPolicy(TextHook::DialogueResponse, policyFor(hooks.enableDialogue));
+  SetPolicy(TextHook::DialogueMenu, policyFor(hooks.enableDialogueMenu));
+  SetPolicy(TextHook::Quest, policyFor(hooks.enableQuest));
+  SetPolicy(TextHook::MapMarker, policyFor(hooks.enableMapMarker));
+  SetPolicy(TextHook::NpcName, policyFor(hooks.enableNpcName));
+}
+
+HookRegistry::Counters HookRegistry::GetCounters(TextHook hook) const {
+  const auto &entry = entries_[Index(hook)];
+  Counters counters;
+  counters.checked = entry.checked.load(std::memory_order_relaxed);
+  counters.detected = entry.detected.load(std::memory_order_relaxed);
+  counters.replaced = entry.replaced.load(std::memory_order_relaxed);
+  return counters;
+}
+
+std::vector<std::string> HookRegistry::Report() const {
+  std::vector<std::string> lines;
+  lines.reserve(kHookCount);
+  for (std::size_t i = 0; i < kHookCount; ++i) {
+    const auto hook = static_cast<TextHook>(i);
+    const auto counters = GetCounters(hook);
+    lines.push_back(fmt::format(
+        "{:<12} {:<6}{} checked {}, detected {}, replaced {}", GetHookKey(hook),
+        GetHookPolicyName(GetPolicy(hook)),
+        IsBound(hook) ? "" : " (not installed)", counters.checked,
+        counters.detected, counters.replaced));
+  }
+  return lines;
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "TextSanitization/TextSanitizer.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Easy2Read {
+
+/**
+ * What a text hook does with the text after the original function returns.
+ */
+enum class HookPolicy : std::uint8_t {
+  PassThrough, // Leave the text alone
+  DetectOnly,  // Report unsupported characters
+  Replace      // Sanitize the text
+};
+
+[[nodiscard]] std::string_view GetHookPolicyName(HookPolicy policy);
+
+/**
+ * Per-hook detour body, swappable while game threads are calling it.
+ * Holds one function per policy; the detour calls the active one through a
+ * single atomic load and indirect call, so a pass-through hook costs no more
+ * than that. Bodies are plain functions that are never freed, so a call that
+ * loaded the previous body finishes safely.
+ */
+template <class... Args> class HookBody {
+public:
+  using Fn = void (*)(Args...);
+
+  constexpr HookBody(Fn passThrough, Fn detectOnly, Fn replace)
+      : bodies_{passThrough, detectOnly, replace}, active_(passThrough) {}
+
+  void Select(HookPolicy policy) {
+    active_.store(bodies_[static_cast<std::size_t>(policy)],
+                  std::memory_order_release);
+  }
+
+  void operator()(Args... args) const {
+    active_.load(std::memory_order_acquire)(args...);
+  }
+
+private:
+  std::array<Fn, 3> bodies_;
+  std::atomic<Fn> active_;
+};
+
+/**
+ * Runtime policy and counters for each text hook.
+ * Policies start from the INI (Mode and the Enable...Hook keys) and can be
+ * changed later with "e2r <hook> <policy>" or "e2r reload". A policy can't
+ * exceed the sanitizer Mode: Replace needs Mode = On, DetectOnly needs it
+ * not Off. Hooks disabled in the INI at data load are never installed and
+ * stay off until the game is restarted.
+ */
+class HookRegistry {
+public:
+  // Called with the new policy whenever it changes (switches the HookBody)
+  using Selector = void (*)(HookPolicy);
+
+  struct Counters {
+    std::uint64_t checked = 0;  // Calls handled by DetectOnly/Replace bodies
+    std::uint64_t detected = 0; // Texts with unsupported characters
+    std::uint64_t replaced = 0; // Texts rewritten
+  };
+
+  [[nodiscard]] static HookRegistry *GetSingleton();
+
+  // Parse a hook key as used in the INI and console ("quest", "npcname", ...)
+  [[nodiscard]] static std::optional<TextHook> ParseHook(std::string_view key);
+  [[nodiscard]] static std::string_view GetHookKey(TextHook hook);
+  [[nodiscard]] static std::optional<HookPolicy>
+  ParsePolicy(std::string_view name);
+
+  // Attach an installed hook; applies its current policy immediately
+  void Bind(TextHook hook, Selector selector);
+  [[nodiscard]] bool IsBound(TextHook hook) const;
+
+  // Called once the hooks are installed; unbound hooks stay off from now on
+  void Seal();
+
+  /**
+   * Change a hook's policy, limited by the sanitizer Mode.
+   * @return The policy actually applied
+   */
+  HookPolicy SetPolicy(TextHook hook, HookPolicy policy);
+
+  [[nodiscard]] HookPolicy GetPolicy(TextHook hook) const {
+    return entries_[Index(hook)].policy.load(std::memory_order_relaxed);
+  }
+
+  // Re-read the Enable...Hook keys from Settings and apply them
+  void LoadFromSettings();
+
+  // Counters, called by the hook bodies
+  void CountChecked(TextHook hook) {
+    entries_[Index(hook)].checked.fetch_add(1, std::memory_order_relaxed);
+  }
+  void CountDetected(TextHook hook) {
+    entries_[Index(hook)].detected.fetch_add(1, std::memory_order_relaxed);
+  }
+  void CountReplaced(TextHook hook) {
+    entries_[Index(hook)].replaced.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] Counters GetCounters(TextHook hook) const;
+
+  // One line per hook: policy and counters (for the console and log)
+  [[nodiscard]] std::vector<std::string> Report() const;
+
+private:
+  HookRegistry() = default;
+  ~HookRegistry() = default;
+  HookRegistry(const HookRegistry &) = delete;
+  HookRegistry(HookRegistry &&) = delete;
+  HookRegistry &operator=(const HookRegistry &) = delete;
+  HookRegistry &operator=(HookRegistry &&) = delete;
+
+  static constexpr auto kHookCount = static_cast<std::size_t>(TextHook::kTotal);
+
+  static constexpr std::size_t Index(TextHook hook) {
+    return static_cast<std::size_t>(hook);
+  }
+
+  // Highest policy the current sanitizer Mode supports
+  [[nodiscard]] static HookPolicy MaxPolicy();
+
+  // Cache-line sized so hooks on different threads don't share counters
+  struct alignas(64) Entry {
+    std::atomic<HookPolicy> policy{HookPolicy::PassThrough};
+    std::atomic<Selector> selector{nullptr};
+    std::atomic<std::uint64_t> checked{0};
+    std::atomic<std::uint64_t> detected{0};
+    std::atomic<std::uint64_t> replaced{0};
+  };
+
+  std::mutex lock_; // Serializes policy changes
+  bool sealed_ = false;
+  std::array<Entry, kHookCount> entries_;
+};
+
+} // namespace Easy2Read
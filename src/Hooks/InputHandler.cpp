@@ -3,7 +3,6 @@
 #include "MenuWatcher.h"
 #include "PCH.h"
 #include "UI/Overlay.h"
-#include "Utils/BookUtils.h"
 
 namespace Easy2Read {
 
@@ -99,6 +98,24 @@ RE::BSEventNotifyControl InputHandler::ProcessEvent(
 
     std::uint32_t keyCode = buttonEvent->GetIDCode();
 
+    // Page turning (page mode)
+    if (overlay->IsVisible() && settings->pageMode) {
+      if ((buttonEvent->device == RE::INPUT_DEVICE::kKeyboard &&
+           keyCode == kKeyPageUp) ||
+          (buttonEvent->device == RE::INPUT_DEVICE::kGamepad &&
+           keyCode == kGamepadLeftShoulder)) {
+        overlay->TurnPages(-1);
+        continue;
+      }
+      if ((buttonEvent->device == RE::INPUT_DEVICE::kKeyboard &&
+           keyCode == kKeyPageDown) ||
+          (buttonEvent->device == RE::INPUT_DEVICE::kGamepad &&
+           keyCode == kGamepadRightShoulder)) {
+        overlay->TurnPages(1);
+        continue;
+      }
+    }
+
     // Keyboard toggle
     if (buttonEvent->device == RE::INPUT_DEVICE::kKeyboard) {
       if (keyCode == settings->toggleKey) {
@@ -108,13 +125,7 @@ RE::BSEventNotifyControl InputHandler::ProcessEvent(
           overlay->Hide();
         } else {
           // Set content and show overlay
-          auto book = menuWatcher->GetCurrentBook();
-          if (book) {
-            std::string title = BookUtils::GetBookTitle(book);
-            std::string text = BookUtils::GetBookText(book);
-            overlay->SetContent(title, text);
-          }
-          overlay->Show();
+          ShowCurrentBook();
         }
       }
     }
@@ -131,13 +142,7 @@ RE::BSEventNotifyControl InputHandler::ProcessEvent(
         if (overlay->IsVisible()) {
           overlay->Hide();
         } else {
-          auto book = menuWatcher->GetCurrentBook();
-          if (book) {
-            std::string title = BookUtils::GetBookTitle(book);
-            std::string text = BookUtils::GetBookText(book);
-            overlay->SetContent(title, text);
-          }
-          overlay->Show();
+          ShowCurrentBook();
         }
       }
     }
@@ -146,6 +151,17 @@ RE::BSEventNotifyControl InputHandler::ProcessEvent(
   return RE::BSEventNotifyControl::kContinue;
 }
 
+void InputHandler::ShowCurrentBook() {
+  auto *overlay = Overlay::GetSingleton();
+
+  // MenuWatcher publishes the document to the overlay when it is ready;
+  // until then the overlay shows a placeholder
+  if (auto document = MenuWatcher::GetSingleton()->GetCurrentDocument()) {
+    overlay->SetContent(std::move(document));
+  }
+  overlay->Show();
+}
+
 void InputHandler::ToggleOverlay() { Overlay::GetSingleton()->Toggle(); }
 
 void InputHandler::ShowOverlay() { Overlay::GetSingleton()->Show(); }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 
 namespace Easy2Read {
 
@@ -33,6 +34,15 @@ private:
   InputHandler &operator=(const InputHandler &) = delete;
   InputHandler &operator=(InputHandler &&) = delete;
 
+  // Page turning keys: DirectInput scan codes and XInput button masks
+  static constexpr std::uint32_t kKeyPageUp = 0xC9;
+  static constexpr std::uint32_t kKeyPageDown = 0xD1;
+  static constexpr std::uint32_t kGamepadLeftShoulder = 0x0100;
+  static constexpr std::uint32_t kGamepadRightShoulder = 0x0200;
+
+  // Hand the open book's document to the overlay and show it
+  void ShowCurrentBook();
+
   std::atomic<bool> overlayVisible{false};
 };
 
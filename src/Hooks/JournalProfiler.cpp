@@ -0,0 +1,67 @@
+#include "JournalProfiler.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+JournalProfiler *JournalProfiler::GetSingleton() {
+  static JournalProfiler singleton;
+  return &singleton;
+}
+
+void JournalProfiler::OnJournalOpen() {
+  hookCalls_.store(0, std::memory_order_relaxed);
+  hookCacheHits_.store(0, std::memory_order_relaxed);
+  hookNanoseconds_.store(0, std::memory_order_relaxed);
+  journalOpen_.store(true, std::memory_order_relaxed);
+  visits_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JournalProfiler::OnJournalClose() {
+  if (!journalOpen_.exchange(false, std::memory_order_relaxed)) {
+    return;
+  }
+
+  const auto calls = hookCalls_.load(std::memory_order_relaxed);
+  if (calls == 0) {
+    return;
+  }
+  const auto hits = hookCacheHits_.load(std::memory_order_relaxed);
+  const auto hookNs = hookNanoseconds_.load(std::memory_order_relaxed);
+
+  // Baseline: every call of this visit at the session's average miss cost
+  const auto misses = totalCalls_.load(std::memory_order_relaxed) -
+                      totalCacheHits_.load(std::memory_order_relaxed);
+  const auto missNs =
+      misses ? missNanoseconds_.load(std::memory_order_relaxed) / misses : 0;
+  SKSE::log::info("JournalProfiler: Quest text hook {} calls in {} us ({} "
+                  "from cache); {} us uncached",
+                  calls, hookNs / 1000, hits, calls * missNs / 1000);
+}
+
+void JournalProfiler::RecordHookCall(std::uint64_t nanoseconds,
+                                     bool cacheHit) {
+  hookCalls_.fetch_add(1, std::memory_order_relaxed);
+  hookNanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  totalCalls_.fetch_add(1, std::memory_order_relaxed);
+  if (cacheHit) {
+    hookCacheHits_.fetch_add(1, std::memory_order_relaxed);
+    totalCacheHits_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    missNanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  }
+}
+
+void JournalProfiler::LogStats() const {
+  const auto calls = totalCalls_.load(std::memory_order_relaxed);
+  const auto hits = totalCacheHits_.load(std::memory_order_relaxed);
+  const auto missNs =
+      calls > hits
+          ? missNanoseconds_.load(std::memory_order_relaxed) / (calls - hits)
+          : 0;
+  SKSE::log::info("JournalProfiler: {} journal visits, {} quest text calls, "
+                  "{} from cache, {} ns per uncached call",
+                  visits_.load(std::memory_order_relaxed), calls, hits,
+                  missNs);
+}
+
+} // namespace Easy2Read
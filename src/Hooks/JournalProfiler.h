@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Easy2Read {
+
+/**
+ * Times QuestTextHook for each visit to the Journal menu.
+ *
+ * Stage log text (QUST CNAM) is loaded from the string files by the very
+ * function QuestTextHook wraps and is not resident on the quest form, so it
+ * can't be collected and sanitized ahead of the journal. What makes an open
+ * cheap is the result cache instead: descriptions seen before, in this
+ * session or an earlier one (PersistentCache), only cost a lookup.
+ *
+ * Each visit logs the hook time against a baseline of the same calls at the
+ * session's average uncached cost, so cold and warm opens can be compared.
+ */
+class JournalProfiler {
+public:
+  [[nodiscard]] static JournalProfiler *GetSingleton();
+
+  // Menu events, forwarded by MenuWatcher (game thread)
+  void OnJournalOpen();
+  void OnJournalClose();
+
+  [[nodiscard]] bool IsJournalOpen() const {
+    return journalOpen_.load(std::memory_order_relaxed);
+  }
+
+  // Account one QuestTextHook call made while the journal is open
+  void RecordHookCall(std::uint64_t nanoseconds, bool cacheHit);
+
+  void LogStats() const;
+
+private:
+  JournalProfiler() = default;
+  JournalProfiler(const JournalProfiler &) = delete;
+  JournalProfiler(JournalProfiler &&) = delete;
+  ~JournalProfiler() = default;
+  JournalProfiler &operator=(const JournalProfiler &) = delete;
+  JournalProfiler &operator=(JournalProfiler &&) = delete;
+
+  std::atomic<bool> journalOpen_{false};
+
+  // Current visit
+  std::atomic<std::uint64_t> hookCalls_{0};
+  std::atomic<std::uint64_t> hookCacheHits_{0};
+  std::atomic<std::uint64_t> hookNanoseconds_{0};
+
+  // Totals; misses give the uncached baseline
+  std::atomic<std::uint64_t> visits_{0};
+  std::atomic<std::uint64_t> totalCalls_{0};
+  std::atomic<std::uint64_t> totalCacheHits_{0};
+  std::atomic<std::uint64_t> missNanoseconds_{0};
+};
+
+} // namespace Easy2Read
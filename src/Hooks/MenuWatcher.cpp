@@ -1,6 +1,10 @@
 #include "MenuWatcher.h"
+#include "JournalProfiler.h"
 #include "PCH.h"
+#include "UI/Overlay.h"
+#include "Utils/BookDocument.h"
 #include "Utils/BookUtils.h"
+#include "Utils/TaskQueue.h"
 
 
 namespace Easy2Read {
@@ -48,34 +52,111 @@ RE::BSEventNotifyControl MenuWatcher::ProcessEvent(
     }
   }
 
+  // Time the quest text hook per journal visit
+  if (a_event->menuName == RE::JournalMenu::MENU_NAME) {
+    if (a_event->opening) {
+      JournalProfiler::GetSingleton()->OnJournalOpen();
+    } else {
+      JournalProfiler::GetSingleton()->OnJournalClose();
+    }
+  }
+
   return RE::BSEventNotifyControl::kContinue;
 }
 
 void MenuWatcher::CacheBookData() {
   // Get the book being displayed using the static helper
   currentBook = RE::BookMenu::GetTargetForm();
+  std::uint64_t requested = 0;
+  {
+    std::lock_guard lock(publishLock);
+    requested = ++generation;
+    bookDocument.store(nullptr);
+  }
+  // Until the document is published the overlay shows a placeholder
+  Overlay::GetSingleton()->ClearContent();
+
   if (!currentBook) {
     SKSE::log::warn("Cannot cache book data: GetTargetForm returned null");
     return;
   }
 
-  // Use BookUtils for proper text extraction with markup stripping
-  bookTitle = BookUtils::GetBookTitle(currentBook);
-  bookText = BookUtils::GetBookText(currentBook);
-
   bool isNote = BookUtils::IsNote(currentBook);
 
-  SKSE::log::info("  Book: {} (FormID: {:08X})", bookTitle,
-                  currentBook->GetFormID());
+  SKSE::log::info("  Book: FormID {:08X}", currentBook->GetFormID());
   SKSE::log::info("  Type: {}", isNote ? "Note" : "Book");
-  SKSE::log::info("  Clean text length: {} characters", bookText.length());
+
+  // Alias resolution and the text copy touch forms, so they run as a game
+  // thread task once this event returns; the pipeline runs on a worker
+  SKSE::GetTaskInterface()->AddTask(
+      [this, book = currentBook, requested] { LoadBook(book, requested); });
+}
+
+void MenuWatcher::LoadBook(RE::TESObjectBOOK *book, std::uint64_t requested) {
+  if (requested != generation.load()) {
+    staleResults.fetch_add(1, std::memory_order_relaxed);
+    return; // Closed before the task ran; the book pointer may be stale too
+  }
+
+  auto source = BookUtils::ReadBookSource(book);
+  if (!source) {
+    return;
+  }
+  if (auto ready = BookUtils::FindDocument(source->key)) {
+    Publish(std::move(ready), requested);
+    return;
+  }
+
+  auto shared = std::make_shared<const BookUtils::BookSource>(
+      std::move(*source));
+  const bool submitted = TaskQueue::GetSingleton()->Submit(
+      [this, shared, requested] {
+        if (requested != generation.load()) {
+          staleResults.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+        Publish(BookUtils::BuildDocument(*shared), requested);
+      },
+      TaskPriority::High);
+  if (!submitted) {
+    Publish(BookUtils::BuildDocument(*shared), requested);
+  }
+}
+
+void MenuWatcher::Publish(std::shared_ptr<const BookDocument> document,
+                          std::uint64_t requested) {
+  if (!document) {
+    return;
+  }
+  {
+    std::lock_guard lock(publishLock);
+    if (requested != generation.load()) {
+      // Still in the BookCache for the next time this book is opened
+      staleResults.fetch_add(1, std::memory_order_relaxed);
+      SKSE::log::debug("Dropped stale book result: {}", document->title);
+      return;
+    }
+    bookDocument.store(document);
+    Overlay::GetSingleton()->SetContent(document);
+  }
+
+  SKSE::log::info("  Book: {} ready, clean text length: {} characters",
+                  document->title, document->text.length());
 }
 
 void MenuWatcher::ClearBookCache() {
   currentBook = nullptr;
-  bookTitle.clear();
-  bookText.clear();
+  {
+    std::lock_guard lock(publishLock);
+    ++generation;
+    bookDocument.store(nullptr);
+  }
   SKSE::log::debug("Book cache cleared");
 }
 
+void MenuWatcher::LogStats() const {
+  SKSE::log::info("MenuWatcher: {} book results dropped as stale",
+                  staleResults.load(std::memory_order_relaxed));
+}
+
 } // namespace Easy2Read
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <atomic>
-#include <string>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace Easy2Read {
 
+struct BookDocument;
+
 class MenuWatcher : public RE::BSTEventSink<RE::MenuOpenCloseEvent> {
 public:
   [[nodiscard]] static MenuWatcher *GetSingleton();
@@ -22,16 +26,17 @@ public:
   [[nodiscard]] RE::TESObjectBOOK *GetCurrentBook() const {
     return currentBook;
   }
-  [[nodiscard]] const std::string &GetCurrentBookTitle() const {
-    return bookTitle;
-  }
-  [[nodiscard]] const std::string &GetCurrentBookText() const {
-    return bookText;
+  // Parsed document of the open book; the overlay, search and pagination
+  // all read this. Null while the book is still being processed.
+  [[nodiscard]] std::shared_ptr<const BookDocument> GetCurrentDocument() const {
+    return bookDocument.load();
   }
 
   // Clear cached book data
   void ClearBookCache();
 
+  void LogStats() const;
+
 private:
   MenuWatcher() = default;
   MenuWatcher(const MenuWatcher &) = delete;
@@ -41,13 +46,26 @@ private:
   MenuWatcher &operator=(const MenuWatcher &) = delete;
   MenuWatcher &operator=(MenuWatcher &&) = delete;
 
-  // Extract book data when menu opens
+  // Start processing the book when the menu opens. The event only records
+  // the book and a generation; the work runs after the event returns.
   void CacheBookData();
 
+  // Game-thread task: read the book and process it on a worker
+  void LoadBook(RE::TESObjectBOOK *book, std::uint64_t requested);
+
+  // Make a finished document current, unless the menu closed or another
+  // book opened since it was requested
+  void Publish(std::shared_ptr<const BookDocument> document,
+               std::uint64_t requested);
+
   std::atomic<bool> bookMenuOpen{false};
   RE::TESObjectBOOK *currentBook{nullptr};
-  std::string bookTitle;
-  std::string bookText;
+  std::atomic<std::shared_ptr<const BookDocument>> bookDocument;
+
+  // Bumped on every open and close; results carry the value they started with
+  std::atomic<std::uint64_t> generation{0};
+  std::mutex publishLock; // Orders Publish against open/close
+  std::atomic<std::uint64_t> staleResults{0};
 };
 
 } // namespace Easy2Read
@@ -0,0 +1,100 @@
+#include "NameTable.h"
+#include "HookRegistry.h"
+#include "PCH.h"
+#include "TextSanitization/TextSanitizer.h"
+
+#include <unordered_map>
+
+namespace Easy2Read {
+
+namespace {
+// Names already replaced, keyed by the game's interned original. Equal names
+// share one BSFixedString, so duplicates (e.g. many "Bandit" NPCs) are
+// sanitized once.
+using Replacements = std::unordered_map<const char *, RE::BSFixedString>;
+
+// Sanitize one name; returns true if it was replaced
+bool SanitizeName(RE::TESFullName &a_name, Replacements &a_replacements,
+                  NameTable::Stats &a_stats) {
+  const char *name = a_name.GetFullName();
+  if (!name || name[0] == '\0') {
+    return false;
+  }
+
+  ++a_stats.scanned;
+  if (const auto it = a_replacements.find(name); it != a_replacements.end()) {
+    a_name.fullName = it->second;
+    ++a_stats.rewritten;
+    return true;
+  }
+
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  const std::string_view text(name);
+  if (!sanitizer->NeedsSanitization(text)) {
+    return false;
+  }
+
+  // BSFixedString must point into the game's string cache, which keeps the
+  // sanitized name for the session
+  const std::string sanitized = sanitizer->Sanitize(text);
+  if (sanitized == text) {
+    return false;
+  }
+  a_name.fullName = RE::BSFixedString(sanitized.c_str());
+  a_replacements.emplace(name, a_name.fullName);
+  ++a_stats.rewritten;
+  return true;
+}
+} // namespace
+
+NameTable::Stats NameTable::Apply() {
+  Stats stats;
+
+  // Replace policy is only granted in Mode = On (see HookRegistry)
+  auto *registry = HookRegistry::GetSingleton();
+  const bool npcNames =
+      registry->GetPolicy(TextHook::NpcName) == HookPolicy::Replace;
+  const bool mapMarkers =
+      registry->GetPolicy(TextHook::MapMarker) == HookPolicy::Replace;
+  if (!npcNames && !mapMarkers) {
+    return stats;
+  }
+
+  Replacements replacements;
+
+  auto [forms, lock] = RE::TESForm::GetAllForms();
+  {
+    RE::BSReadLockGuard guard{lock};
+    for (auto &[formID, form] : *forms) {
+      if (!form) {
+        continue;
+      }
+
+      if (npcNames && form->GetFormType() == RE::FormType::NPC) {
+        if (auto *fullName = form->As<RE::TESFullName>()) {
+          if (SanitizeName(*fullName, replacements, stats)) {
+            SKSE::log::debug("NameTable: Sanitized NPC name {:08X}", formID);
+          }
+        }
+        continue;
+      }
+
+      if (mapMarkers && form->GetFormType() == RE::FormType::Reference) {
+        auto *ref = static_cast<RE::TESObjectREFR *>(form);
+        auto *marker = ref->extraList.GetByType<RE::ExtraMapMarker>();
+        if (marker && marker->mapData &&
+            SanitizeName(marker->mapData->locationName, replacements,
+                         stats)) {
+          SKSE::log::debug("NameTable: Sanitized map marker {:08X}", formID);
+        }
+      }
+    }
+  }
+
+  SKSE::log::info("NameTable: Rewrote {} of {} NPC/map marker names ({} "
+                  "distinct)",
+                  stats.rewritten, stats.scanned, replacements.size());
+  return stats;
+}
+
+} // namespace Easy2Read
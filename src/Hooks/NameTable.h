@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Easy2Read {
+
+/**
+ * Load-time replacement of NPC and map marker names (NPC FULL, REFR FULL).
+ * These names are read straight from TESFullName every frame, so instead of
+ * sanitizing per call, every affected name is sanitized once after data load
+ * and the form's name is repointed at the sanitized text. Sanitized names are
+ * interned in the game's string cache, and duplicates (e.g. many "Bandit"
+ * NPCs) are processed once.
+ */
+class NameTable {
+public:
+  struct Stats {
+    std::uint32_t scanned = 0;   // Names checked
+    std::uint32_t rewritten = 0; // Names replaced with sanitized text
+  };
+
+  /**
+   * Sanitize all NPC and map marker names. Called at kDataLoaded and again
+   * when a name hook is switched on at runtime. Only names whose hook policy
+   * is Replace are touched; otherwise the name hooks report instead.
+   */
+  static Stats Apply();
+};
+
+} // namespace Easy2Read
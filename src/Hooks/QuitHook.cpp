@@ -0,0 +1,28 @@
+#include "QuitHook.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+void QuitHook::ExitProcess_Hook(unsigned int a_exitCode) {
+  static std::atomic<bool> done{false};
+  if (_onQuit && !done.exchange(true)) {
+    SKSE::log::info("QuitHook: Game is quitting, shutting down");
+    _onQuit();
+  }
+  reinterpret_cast<decltype(&ExitProcess_Hook)>(_ExitProcess)(a_exitCode);
+}
+
+void QuitHook::Install(void (*a_onQuit)()) {
+  _onQuit = a_onQuit;
+  _ExitProcess = SKSE::PatchIAT(reinterpret_cast<std::uintptr_t>(
+                                    &ExitProcess_Hook),
+                                "kernel32.dll", "ExitProcess");
+  if (!_ExitProcess) {
+    SKSE::log::warn("QuitHook: ExitProcess import not found; final reports "
+                    "and the persistent cache are only written on save");
+    return;
+  }
+  SKSE::log::info("QuitHook: Installed");
+}
+
+} // namespace Easy2Read
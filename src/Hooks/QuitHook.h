@@ -0,0 +1,24 @@
+#pragma once
+
+#include "PCH.h"
+
+namespace Easy2Read {
+
+/**
+ * Runs a callback when the game quits, before the process tears anything
+ * down. Hooks the game's import of ExitProcess, which the CRT calls after
+ * the game's own shutdown: game threads and our workers are still alive and
+ * no static has been destroyed yet. atexit handlers and static destructors
+ * of a DLL run later, after Windows has already ended every other thread.
+ */
+struct QuitHook {
+  static void ExitProcess_Hook(unsigned int a_exitCode);
+
+  // Call once at plugin load; a_onQuit runs at most once
+  static void Install(void (*a_onQuit)());
+
+  static inline std::uintptr_t _ExitProcess = 0;
+  static inline void (*_onQuit)() = nullptr;
+};
+
+} // namespace Easy2Read
@@ -1,6 +1,18 @@
 #include "TextHooks.h"
+#include "DescriptionCache.h"
+#include "HookProfiler.h"
+#include "HookRegistry.h"
+#include "JournalProfiler.h"
 #include "PCH.h"
+#include "TextSanitization/AuditReport.h"
+#include "TextSanitization/CaptureWriter.h"
+#include "TextSanitization/CleanTextCache.h"
+#include "TextSanitization/PersistentCache.h"
+#include "TextSanitization/SanitizedTextCache.h"
+#include "TextSanitization/StringPool.h"
 #include "TextSanitization/TextSanitizer.h"
+#include "Utils/Hash.h"
+#include <chrono>
 #include <MinHook.h>
 #include <xbyak/xbyak.h>
 
@@ -47,6 +59,93 @@ namespace Easy2Read {
 // MinHook initialization flag
 static bool g_minHookInitialized = false;
 
+// Hand offending text to the DetectOnly audit report (no I/O on this thread).
+// Hooks without a form pass the record type the text comes from instead.
+static void ReportDetection(TextHook a_hook, const RE::TESForm *a_form,
+                            std::string_view a_text,
+                            std::string_view a_recordType = ""sv) {
+  auto *report = AuditReport::GetSingleton();
+  if (!report->IsEnabled()) {
+    return;
+  }
+  report->Record(a_hook, a_form ? a_form->GetFormID() : 0,
+                 a_form ? RE::FormTypeToString(a_form->GetFormType())
+                        : a_recordType,
+                 a_text);
+}
+
+// Record hook input for offline replay (capture mode only)
+static void CaptureInput(TextHook a_hook, const RE::TESForm *a_form,
+                         std::string_view a_text) {
+  auto *capture = CaptureWriter::GetSingleton();
+  if (capture->IsEnabled()) {
+    capture->Record(a_hook, a_form ? a_form->GetFormID() : 0, a_text);
+  }
+}
+
+// Body for hooks set to pass through: the original's output is left as is
+template <class... Args> static void PassThrough(Args...) {}
+
+// Field layout of RE::BSString, whose members are private
+struct BSStringLayout {
+  char *data;
+  std::uint16_t size;
+  std::uint16_t capacity; // Includes the NUL terminator
+  std::uint32_t pad;
+};
+static_assert(sizeof(BSStringLayout) == sizeof(RE::BSString));
+
+// BSString stores this size when the length does not fit in 16 bits
+constexpr std::uint16_t kBSStringSizeUnknown = 0xFFFF;
+
+// Whether a BSString's buffer can be written directly
+static bool IsRewritable(const BSStringLayout &a_raw) {
+  return a_raw.data && a_raw.capacity > 0 &&
+         a_raw.size != kBSStringSizeUnknown && a_raw.size < a_raw.capacity;
+}
+
+// Sanitize a BSString in one pass, rewriting its buffer in place when the
+// result fits; otherwise reallocate once at the exact output size.
+// Returns true if the text changed.
+static bool SanitizeBSString(RE::BSString &a_str) {
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  auto &raw = reinterpret_cast<BSStringLayout &>(a_str);
+  if (!IsRewritable(raw)) {
+    const std::string_view text(a_str.c_str(), a_str.length());
+    std::string_view sanitized = sanitizer->SanitizeInterned(text);
+    if (sanitized == text) {
+      return false;
+    }
+    a_str = sanitized;
+    return true;
+  }
+
+  thread_local std::string overflow;
+  const auto result = sanitizer->SanitizeInPlace(
+      raw.data, raw.size, static_cast<std::size_t>(raw.capacity - 1), overflow);
+  if (!result.changed) {
+    return false;
+  }
+  if (result.inPlace) {
+    raw.size = static_cast<std::uint16_t>(result.length);
+  } else {
+    a_str = std::string_view(overflow);
+  }
+  return true;
+}
+
+// Replace a BSString's text, reusing its buffer when the text fits
+static void AssignBSString(RE::BSString &a_str, std::string_view a_text) {
+  auto &raw = reinterpret_cast<BSStringLayout &>(a_str);
+  if (IsRewritable(raw) && a_text.size() < raw.capacity) {
+    std::memcpy(raw.data, a_text.data(), a_text.size());
+    raw.data[a_text.size()] = '\0';
+    raw.size = static_cast<std::uint16_t>(a_text.size());
+  } else {
+    a_str = a_text;
+  }
+}
+
 // ============================================================================
 // GetDescriptionHook - DESC/CNAM records (books, items, spells, etc.)
 // Uses MinHook for compatibility with Dynamic String Distributor
@@ -57,29 +156,125 @@ using GetDescriptionFunc = void (*)(RE::TESDescription *, RE::BSString &,
                                     RE::TESForm *, std::uint32_t);
 static GetDescriptionFunc g_originalGetDescription = nullptr;
 
+// Skip MESG (Message) records - they cause crashes during sanitization
+static bool IsDescriptionSkipped(const RE::BSString &a_out,
+                                 const RE::TESForm *a_parent) {
+  return a_out.length() == 0 ||
+         (a_parent && a_parent->GetFormType() == RE::FormType::Message);
+}
+
+static void DescriptionDetect([[maybe_unused]] RE::TESDescription *a_desc,
+                              RE::BSString &a_out, RE::TESForm *a_parent,
+                              std::uint32_t a_chunkID) {
+  if (IsDescriptionSkipped(a_out, a_parent)) {
+    return;
+  }
+
+  const std::string_view text(a_out.c_str(), a_out.length());
+  CaptureInput(TextHook::Description, a_parent, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::Description);
+
+  const std::uint32_t formID = a_parent ? a_parent->GetFormID() : 0;
+  const std::uint64_t sourceHash = HashText(text);
+  auto *cleanCache = CleanTextCache::GetSingleton();
+  if (cleanCache->IsKnownClean(TextHook::Description, formID, sourceHash,
+                               a_chunkID)) {
+    return;
+  }
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    cleanCache->MarkClean(TextHook::Description, formID, sourceHash,
+                          a_chunkID);
+    return;
+  }
+  cleanCache->Invalidate(TextHook::Description, formID, a_chunkID);
+  registry->CountDetected(TextHook::Description);
+  ReportDetection(TextHook::Description, a_parent, text);
+}
+
+static void DescriptionReplace(RE::TESDescription *a_desc, RE::BSString &a_out,
+                               RE::TESForm *a_parent, std::uint32_t a_chunkID) {
+  if (IsDescriptionSkipped(a_out, a_parent)) {
+    return;
+  }
+
+  // Descriptions are re-queried every frame while a tooltip or menu entry is
+  // shown; reuse the sanitized text as long as the original output is unchanged
+  const std::string_view text(a_out.c_str(), a_out.length());
+  const DescriptionCache::Key cacheKey{a_desc,
+                                       a_parent ? a_parent->GetFormID() : 0,
+                                       a_chunkID};
+  CaptureInput(TextHook::Description, a_parent, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::Description);
+  const std::uint64_t sourceHash = HashText(text);
+  auto *cleanCache = CleanTextCache::GetSingleton();
+  if (cleanCache->IsKnownClean(TextHook::Description, cacheKey.parentFormID,
+                               sourceHash, a_chunkID)) {
+    return;
+  }
+
+  auto *cache = DescriptionCache::GetSingleton();
+  if (auto cached = cache->Lookup(cacheKey, sourceHash)) {
+    if (*cached != text) {
+      AssignBSString(a_out, *cached);
+      registry->CountReplaced(TextHook::Description);
+    }
+    return;
+  }
+
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    cleanCache->MarkClean(TextHook::Description, cacheKey.parentFormID,
+                          sourceHash, a_chunkID);
+    return;
+  }
+  cleanCache->Invalidate(TextHook::Description, cacheKey.parentFormID,
+                         a_chunkID);
+  registry->CountDetected(TextHook::Description);
+
+  // Results from earlier launches survive in the persistent cache
+  auto *persistent = PersistentCache::GetSingleton();
+  if (auto stored = persistent->Lookup(sourceHash, text.size())) {
+    cache->Store(cacheKey, sourceHash, *stored, 0);
+    AssignBSString(a_out, *stored);
+    registry->CountReplaced(TextHook::Description);
+    return;
+  }
+
+  const std::size_t sourceLength = text.size();
+  const auto start = std::chrono::steady_clock::now();
+  const bool changed = SanitizeBSString(a_out);
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+  const auto pooled = StringPool::GetSingleton()->Intern(
+      std::string_view(a_out.c_str(), a_out.length()));
+  cache->Store(cacheKey, sourceHash, pooled,
+               static_cast<std::uint64_t>(elapsed.count()));
+  persistent->Append(sourceHash, sourceLength, pooled);
+
+  if (changed) {
+    registry->CountReplaced(TextHook::Description);
+    SKSE::log::debug("TextHooks: Sanitized DESC/CNAM for form {:08X}",
+                     cacheKey.parentFormID);
+  }
+}
+
+static HookBody<RE::TESDescription *, RE::BSString &, RE::TESForm *,
+                std::uint32_t>
+    g_descriptionBody{&PassThrough, &DescriptionDetect, &DescriptionReplace};
+
 // Our hook function
 void GetDescriptionDetour(RE::TESDescription *a_desc, RE::BSString &a_out,
                           RE::TESForm *a_parent, std::uint32_t a_chunkID) {
+  HookProfiler::Sample sample(TextHook::Description);
+
   // Call the original (or next hook in chain if DSD is installed)
   if (g_originalGetDescription) {
     g_originalGetDescription(a_desc, a_out, a_parent, a_chunkID);
   }
+  sample.OriginalDone();
 
-  // Skip MESG (Message) records - they cause crashes during sanitization
-  if (a_parent && a_parent->GetFormType() == RE::FormType::Message) {
-    return;
-  }
-
-  // Sanitize the output
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled() && a_out.length() > 0) {
-    std::string sanitized = sanitizer->Sanitize(a_out.c_str());
-    if (sanitized != a_out.c_str()) {
-      a_out = sanitized;
-      SKSE::log::debug("TextHooks: Sanitized DESC/CNAM for form {:08X}",
-                       a_parent ? a_parent->GetFormID() : 0);
-    }
-  }
+  g_descriptionBody(a_desc, a_out, a_parent, a_chunkID);
 }
 
 void TextHooks::GetDescriptionHook::Install() {
@@ -122,24 +317,101 @@ void TextHooks::GetDescriptionHook::Install() {
 // ============================================================================
 // DialogueResponseHook - INFO NAM1 (dialogue subtitles)
 // ============================================================================
+static void DialogueResponseDetect(RE::DialogueResponse *a_result,
+                                   RE::TESTopicInfo *a_topicInfo,
+                                   RE::TESTopicInfo::ResponseData *a_response) {
+  if (!a_result || a_result->text.length() == 0) {
+    return;
+  }
+
+  const std::string_view text(a_result->text.c_str(), a_result->text.length());
+  CaptureInput(TextHook::DialogueResponse, a_topicInfo, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::DialogueResponse);
+
+  const std::uint32_t formID = a_topicInfo ? a_topicInfo->GetFormID() : 0;
+  const std::uint32_t responseNumber =
+      a_response ? a_response->responseNumber : 0;
+  const std::uint64_t textHash = HashText(text);
+  auto *cleanCache = CleanTextCache::GetSingleton();
+  if (cleanCache->IsKnownClean(TextHook::DialogueResponse, formID, textHash,
+                               responseNumber)) {
+    return;
+  }
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    cleanCache->MarkClean(TextHook::DialogueResponse, formID, textHash,
+                          responseNumber);
+    return;
+  }
+  cleanCache->Invalidate(TextHook::DialogueResponse, formID, responseNumber);
+  registry->CountDetected(TextHook::DialogueResponse);
+  ReportDetection(TextHook::DialogueResponse, a_topicInfo, text);
+}
+
+static void DialogueResponseReplace(RE::DialogueResponse *a_result,
+                                    RE::TESTopicInfo *a_topicInfo,
+                                    RE::TESTopicInfo::ResponseData *a_response) {
+  if (!a_result || a_result->text.length() == 0) {
+    return;
+  }
+
+  // Most responses are clean; skip the scan when this INFO's text is unchanged
+  const std::string_view text(a_result->text.c_str(), a_result->text.length());
+  CaptureInput(TextHook::DialogueResponse, a_topicInfo, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::DialogueResponse);
+  const std::uint32_t formID = a_topicInfo ? a_topicInfo->GetFormID() : 0;
+  const std::uint32_t responseNumber =
+      a_response ? a_response->responseNumber : 0;
+  const std::uint64_t textHash = HashText(text);
+  auto *cleanCache = CleanTextCache::GetSingleton();
+  if (cleanCache->IsKnownClean(TextHook::DialogueResponse, formID, textHash,
+                               responseNumber)) {
+    return;
+  }
+
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    cleanCache->MarkClean(TextHook::DialogueResponse, formID, textHash,
+                          responseNumber);
+    return;
+  }
+  cleanCache->Invalidate(TextHook::DialogueResponse, formID, responseNumber);
+  registry->CountDetected(TextHook::DialogueResponse);
+
+  // Generic lines are shared by many INFOs; reuse results by content
+  auto *results = SanitizedTextCache::GetSingleton();
+  if (auto hit = results->Lookup(textHash, text.size()); hit && !hit->clean) {
+    AssignBSString(a_result->text, hit->sanitized);
+    registry->CountReplaced(TextHook::DialogueResponse);
+    return;
+  }
+
+  const std::size_t sourceLength = text.size();
+  if (SanitizeBSString(a_result->text)) {
+    registry->CountReplaced(TextHook::DialogueResponse);
+    SKSE::log::debug("TextHooks: Sanitized dialogue for INFO {:08X}", formID);
+  }
+  results->StoreSanitized(
+      textHash, sourceLength,
+      StringPool::GetSingleton()->Intern(
+          std::string_view(a_result->text.c_str(), a_result->text.length())));
+}
+
+static HookBody<RE::DialogueResponse *, RE::TESTopicInfo *,
+                RE::TESTopicInfo::ResponseData *>
+    g_dialogueResponseBody{&PassThrough, &DialogueResponseDetect,
+                           &DialogueResponseReplace};
+
 RE::DialogueResponse *TextHooks::DialogueResponseHook::thunk(
     RE::DialogueResponse *a_item, RE::TESTopic *a_topic,
     RE::TESTopicInfo *a_topicInfo, RE::TESObjectREFR *a_speaker,
     RE::TESTopicInfo::ResponseData *a_response) {
   // Call original function first
+  HookProfiler::Sample sample(TextHook::DialogueResponse);
   auto *result = func(a_item, a_topic, a_topicInfo, a_speaker, a_response);
+  sample.OriginalDone();
 
-  // Sanitize the dialogue text
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled() && result && result->text.length() > 0) {
-    std::string sanitized = sanitizer->Sanitize(result->text.c_str());
-    if (sanitized != result->text.c_str()) {
-      result->text = sanitized;
-      SKSE::log::debug("TextHooks: Sanitized dialogue for INFO {:08X}",
-                       a_topicInfo ? a_topicInfo->GetFormID() : 0);
-    }
-  }
-
+  g_dialogueResponseBody(result, a_topicInfo, a_response);
   return result;
 }
 
@@ -165,21 +437,81 @@ void TextHooks::DialogueResponseHook::Install() {
 // ============================================================================
 // DialogueMenuTextHook - DIAL FULL, INFO RNAM (dialogue menu options)
 // ============================================================================
+static void DialogueMenuDetect(RE::MenuTopicManager::Dialogue &a_out) {
+  if (a_out.topicText.length() == 0) {
+    return;
+  }
+
+  const std::string_view text(a_out.topicText.c_str(),
+                              a_out.topicText.length());
+  CaptureInput(TextHook::DialogueMenu, a_out.parentTopic, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::DialogueMenu);
+
+  const std::uint64_t textHash = HashText(text);
+  auto *results = SanitizedTextCache::GetSingleton();
+  if (auto hit = results->Lookup(textHash, text.size()); hit && hit->clean) {
+    return;
+  }
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    results->StoreClean(textHash, text.size());
+    return;
+  }
+  registry->CountDetected(TextHook::DialogueMenu);
+  ReportDetection(TextHook::DialogueMenu, a_out.parentTopic, text);
+}
+
+static void DialogueMenuReplace(RE::MenuTopicManager::Dialogue &a_out) {
+  if (a_out.topicText.length() == 0) {
+    return;
+  }
+
+  // The list is rebuilt after every line; DialoguePrefetch has usually
+  // sanitized these names already, leaving only a lookup here
+  const std::string_view text(a_out.topicText.c_str(),
+                              a_out.topicText.length());
+  CaptureInput(TextHook::DialogueMenu, a_out.parentTopic, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::DialogueMenu);
+  const std::uint64_t textHash = HashText(text);
+  auto *results = SanitizedTextCache::GetSingleton();
+  if (auto hit = results->Lookup(textHash, text.size())) {
+    if (!hit->clean) {
+      AssignBSString(a_out.topicText, hit->sanitized);
+      registry->CountReplaced(TextHook::DialogueMenu);
+    }
+    return;
+  }
+
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    results->StoreClean(textHash, text.size());
+    return;
+  }
+  registry->CountDetected(TextHook::DialogueMenu);
+
+  const std::size_t sourceLength = text.size();
+  if (SanitizeBSString(a_out.topicText)) {
+    registry->CountReplaced(TextHook::DialogueMenu);
+    SKSE::log::debug("TextHooks: Sanitized dialogue menu text");
+  }
+  results->StoreSanitized(textHash, sourceLength,
+                          StringPool::GetSingleton()->Intern(std::string_view(
+                              a_out.topicText.c_str(),
+                              a_out.topicText.length())));
+}
+
+static HookBody<RE::MenuTopicManager::Dialogue &> g_dialogueMenuBody{
+    &PassThrough, &DialogueMenuDetect, &DialogueMenuReplace};
+
 void TextHooks::DialogueMenuTextHook::thunk(
     RE::MenuTopicManager::Dialogue &a_out, char *a_buffer,
     std::uint64_t a_unk) {
   // Call original function first
+  HookProfiler::Sample sample(TextHook::DialogueMenu);
   func(a_out, a_buffer, a_unk);
+  sample.OriginalDone();
 
-  // Sanitize the topic text
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled() && a_out.topicText.length() > 0) {
-    std::string sanitized = sanitizer->Sanitize(a_out.topicText.c_str());
-    if (sanitized != a_out.topicText.c_str()) {
-      a_out.topicText = sanitized;
-      SKSE::log::debug("TextHooks: Sanitized dialogue menu text");
-    }
-  }
+  g_dialogueMenuBody(a_out);
 }
 
 void TextHooks::DialogueMenuTextHook::Install() {
@@ -201,24 +533,61 @@ void TextHooks::DialogueMenuTextHook::Install() {
 // ============================================================================
 // MapMarkerDataHook - REFR FULL (map marker names)
 // ============================================================================
-RE::TESFullName *
-TextHooks::MapMarkerDataHook::thunk(RE::TESObjectREFR *a_marker) {
-  if (!a_marker || a_marker->IsDisabled()) {
-    return func(a_marker);
+static void MapMarkerDetect(RE::TESObjectREFR *a_marker,
+                            RE::TESFullName *a_name) {
+  if (!a_marker || !a_name || a_marker->IsDisabled()) {
+    return;
+  }
+  const char *name = a_name->GetFullName();
+  if (!name || name[0] == '\0') {
+    return;
   }
 
-  auto *result = func(a_marker);
+  const std::string_view text(name);
+  CaptureInput(TextHook::MapMarker, a_marker, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::MapMarker);
 
-  // Detect unsupported characters (cannot modify TESFullName in-place)
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled() && result) {
-    const char *name = result->GetFullName();
-    if (name && name[0] != '\0' && sanitizer->NeedsSanitization(name)) {
-      SKSE::log::debug("TextHooks: Map marker {:08X} has unsupported chars",
-                       a_marker->GetFormID());
-    }
+  // The world map queries every marker each frame; skip known-clean names
+  const std::uint64_t textHash = HashText(text);
+  auto *cleanCache = CleanTextCache::GetSingleton();
+  if (cleanCache->IsKnownClean(TextHook::MapMarker, a_marker->GetFormID(),
+                               textHash)) {
+    return;
+  }
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    cleanCache->MarkClean(TextHook::MapMarker, a_marker->GetFormID(),
+                          textHash);
+    return;
   }
+  cleanCache->Invalidate(TextHook::MapMarker, a_marker->GetFormID());
+  registry->CountDetected(TextHook::MapMarker);
+  SKSE::log::debug("TextHooks: Map marker {:08X} has unsupported chars",
+                   a_marker->GetFormID());
+  ReportDetection(TextHook::MapMarker, a_marker, text);
+}
 
+// Names were already replaced at data load (see NameTable); only capture
+static void MapMarkerReplace(RE::TESObjectREFR *a_marker,
+                             RE::TESFullName *a_name) {
+  if (!a_marker || !a_name || !CaptureWriter::GetSingleton()->IsEnabled()) {
+    return;
+  }
+  if (const char *name = a_name->GetFullName()) {
+    CaptureInput(TextHook::MapMarker, a_marker, name);
+  }
+}
+
+static HookBody<RE::TESObjectREFR *, RE::TESFullName *> g_mapMarkerBody{
+    &PassThrough, &MapMarkerDetect, &MapMarkerReplace};
+
+RE::TESFullName *
+TextHooks::MapMarkerDataHook::thunk(RE::TESObjectREFR *a_marker) {
+  HookProfiler::Sample sample(TextHook::MapMarker);
+  auto *result = func(a_marker);
+  sample.OriginalDone();
+
+  g_mapMarkerBody(a_marker, result);
   return result;
 }
 
@@ -235,18 +604,44 @@ void TextHooks::MapMarkerDataHook::Install() {
 // ============================================================================
 // NpcNameHook - NPC FULL (NPC names during file load)
 // ============================================================================
+static void NpcNameDetect(RE::TESFullName *a_fullname) {
+  const char *name = a_fullname->GetFullName();
+  if (!name || name[0] == '\0') {
+    return;
+  }
+
+  auto *form = skyrim_cast<RE::TESForm *>(a_fullname);
+  CaptureInput(TextHook::NpcName, form, name);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::NpcName);
+  if (TextSanitizer::GetSingleton()->NeedsSanitization(name)) {
+    registry->CountDetected(TextHook::NpcName);
+    SKSE::log::debug("TextHooks: NPC name has unsupported chars");
+    ReportDetection(TextHook::NpcName, form, name);
+  }
+}
+
+// Names are replaced once at data load (see NameTable); only capture
+static void NpcNameReplace(RE::TESFullName *a_fullname) {
+  if (!CaptureWriter::GetSingleton()->IsEnabled()) {
+    return;
+  }
+  if (const char *name = a_fullname->GetFullName()) {
+    CaptureInput(TextHook::NpcName, skyrim_cast<RE::TESForm *>(a_fullname),
+                 name);
+  }
+}
+
+static HookBody<RE::TESFullName *> g_npcNameBody{&PassThrough, &NpcNameDetect,
+                                                 &NpcNameReplace};
+
 void TextHooks::NpcNameHook::thunk(RE::TESFullName *a_fullname,
                                    RE::TESFile *a_file) {
+  HookProfiler::Sample sample(TextHook::NpcName);
   func(a_fullname, a_file);
+  sample.OriginalDone();
 
-  // Detect unsupported characters (cannot modify TESFullName in-place)
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled()) {
-    const char *name = a_fullname->GetFullName();
-    if (name && name[0] != '\0' && sanitizer->NeedsSanitization(name)) {
-      SKSE::log::debug("TextHooks: NPC name has unsupported chars");
-    }
-  }
+  g_npcNameBody(a_fullname);
 }
 
 void TextHooks::NpcNameHook::Install() {
@@ -262,21 +657,87 @@ void TextHooks::NpcNameHook::Install() {
 // ============================================================================
 // QuestTextHook - QUST CNAM (quest journal descriptions)
 // ============================================================================
+static void QuestDetect(RE::BSString &a_out) {
+  if (a_out.length() == 0) {
+    return;
+  }
+
+  const std::string_view text(a_out.c_str(), a_out.length());
+  CaptureInput(TextHook::Quest, nullptr, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::Quest);
+  if (TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    registry->CountDetected(TextHook::Quest);
+    // The journal builds the text without handing over the quest
+    ReportDetection(TextHook::Quest, nullptr, text, "QUST"sv);
+  }
+}
+
+static void QuestReplace(RE::BSString &a_out) {
+  if (a_out.length() == 0) {
+    return;
+  }
+
+  // The journal re-reads the same descriptions; reuse results by content
+  auto *journal = JournalProfiler::GetSingleton();
+  const bool timed = journal->IsJournalOpen();
+  const auto start = timed ? std::chrono::steady_clock::now()
+                           : std::chrono::steady_clock::time_point{};
+  const auto finish = [&](bool a_cacheHit) {
+    if (timed) {
+      journal->RecordHookCall(
+          static_cast<std::uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count()),
+          a_cacheHit);
+    }
+  };
+
+  const std::string_view text(a_out.c_str(), a_out.length());
+  CaptureInput(TextHook::Quest, nullptr, text);
+  auto *registry = HookRegistry::GetSingleton();
+  registry->CountChecked(TextHook::Quest);
+  const std::uint64_t textHash = HashText(text);
+  auto *results = SanitizedTextCache::GetSingleton();
+  if (auto hit = results->Lookup(textHash, text.size())) {
+    if (!hit->clean) {
+      AssignBSString(a_out, hit->sanitized);
+      registry->CountReplaced(TextHook::Quest);
+    }
+    finish(true);
+    return;
+  }
+
+  if (!TextSanitizer::GetSingleton()->NeedsSanitization(text)) {
+    results->StoreClean(textHash, text.size());
+    finish(false);
+    return;
+  }
+  registry->CountDetected(TextHook::Quest);
+
+  const std::size_t sourceLength = text.size();
+  if (SanitizeBSString(a_out)) {
+    registry->CountReplaced(TextHook::Quest);
+    SKSE::log::debug("TextHooks: Sanitized quest description");
+  }
+  results->StoreSanitized(textHash, sourceLength,
+                          StringPool::GetSingleton()->Intern(std::string_view(
+                              a_out.c_str(), a_out.length())));
+  finish(false);
+}
+
+static HookBody<RE::BSString &> g_questBody{&PassThrough, &QuestDetect,
+                                            &QuestReplace};
+
 void TextHooks::QuestTextHook::thunk(RE::BSString &a_out, char *a_buffer,
                                      std::uint64_t a_unk) {
   // Call original function first
+  HookProfiler::Sample sample(TextHook::Quest);
   func(a_out, a_buffer, a_unk);
+  sample.OriginalDone();
 
-  // Sanitize the quest description text
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled() && a_out.length() > 0) {
-    std::string original = a_out.c_str();
-    std::string sanitized = sanitizer->Sanitize(original);
-    if (sanitized != original) {
-      a_out = sanitized;
-      SKSE::log::debug("TextHooks: Sanitized quest description");
-    }
-  }
+  g_questBody(a_out);
 }
 
 void TextHooks::QuestTextHook::Install() {
@@ -295,30 +756,51 @@ void TextHooks::QuestTextHook::Install() {
 void TextHooks::Install() {
   SKSE::log::info("TextHooks: Installing text sanitization hooks...");
 
-  // Get hook settings from sanitizer
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  const auto &hooks = sanitizer->GetHookSettings();
+  // Hooks disabled in the INI are not patched at all, so a hook that
+  // misbehaves on some runtime can be kept out of the game. Only installed
+  // hooks can be switched at runtime (see HookRegistry).
+  auto *registry = HookRegistry::GetSingleton();
+  const auto &hooks = TextSanitizer::GetSingleton()->GetHookSettings();
 
   if (hooks.enableDescription) {
     GetDescriptionHook::Install();
+    registry->Bind(TextHook::Description, [](HookPolicy a_policy) {
+      g_descriptionBody.Select(a_policy);
+    });
   }
   if (hooks.enableDialogue) {
     DialogueResponseHook::Install();
+    registry->Bind(TextHook::DialogueResponse, [](HookPolicy a_policy) {
+      g_dialogueResponseBody.Select(a_policy);
+    });
   }
   if (hooks.enableDialogueMenu) {
     DialogueMenuTextHook::Install();
+    registry->Bind(TextHook::DialogueMenu, [](HookPolicy a_policy) {
+      g_dialogueMenuBody.Select(a_policy);
+    });
   }
   if (hooks.enableMapMarker) {
     MapMarkerDataHook::Install();
+    registry->Bind(TextHook::MapMarker, [](HookPolicy a_policy) {
+      g_mapMarkerBody.Select(a_policy);
+    });
   }
   if (hooks.enableNpcName) {
     NpcNameHook::Install();
+    registry->Bind(TextHook::NpcName,
+                   [](HookPolicy a_policy) { g_npcNameBody.Select(a_policy); });
   }
   if (hooks.enableQuest) {
     QuestTextHook::Install();
+    registry->Bind(TextHook::Quest,
+                   [](HookPolicy a_policy) { g_questBody.Select(a_policy); });
   }
+  registry->Seal();
 
-  SKSE::log::info("TextHooks: All hooks installed successfully");
+  for (const auto &line : registry->Report()) {
+    SKSE::log::info("TextHooks: {}", line);
+  }
 }
 
 } // namespace Easy2Read
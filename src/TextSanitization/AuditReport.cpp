@@ -0,0 +1,191 @@
+#include "AuditReport.h"
+#include "PCH.h"
+#include "Utils/Hash.h"
+#include <fstream>
+
+namespace Easy2Read {
+
+namespace {
+// Bytes of context kept on each side of the first offending character
+constexpr size_t kContextRadius = 32;
+
+// Append a CSV field, quoting it and flattening line breaks
+void AppendCsvField(std::string &out, std::string_view field) {
+  out += '"';
+  for (char c : field) {
+    if (c == '"') {
+      out += "\"\"";
+    } else if (c == '\n' || c == '\r') {
+      out += ' ';
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+}
+} // namespace
+
+AuditReport *AuditReport::GetSingleton() {
+  static AuditReport singleton;
+  return &singleton;
+}
+
+void AuditReport::Initialize(const std::filesystem::path &reportPath) {
+  if (writer_.joinable()) {
+    return;
+  }
+
+  reportPath_ = reportPath;
+  writer_ = std::thread(&AuditReport::WriterLoop, this);
+  enabled_.store(true);
+
+  SKSE::log::info("AuditReport: DetectOnly audit will be written to {}",
+                  reportPath_.string());
+}
+
+void AuditReport::Record(TextHook hook, std::uint32_t formID,
+                         std::string_view recordType, std::string_view text) {
+  if (!IsEnabled()) {
+    return;
+  }
+
+  // Forms are reported once per hook; formless text is keyed by content
+  const std::uint64_t key =
+      HashCombine(static_cast<std::uint64_t>(hook),
+                  formID != 0 ? formID : HashText(text));
+
+  std::lock_guard lock(lock_);
+  if (!seen_.insert(key).second) {
+    return;
+  }
+  pending_.push_back({hook, formID, recordType, std::string(text)});
+}
+
+void AuditReport::Flush() {
+  if (!IsEnabled()) {
+    return;
+  }
+  {
+    std::lock_guard lock(lock_);
+    flushRequested_ = true;
+  }
+  wake_.notify_one();
+}
+
+AuditReport::~AuditReport() {
+  // Only reached at process teardown without Shutdown(), when Windows has
+  // already ended the writer; joining it would never return
+  if (writer_.joinable()) {
+    writer_.detach();
+  }
+}
+
+void AuditReport::Shutdown() {
+  if (!writer_.joinable()) {
+    return;
+  }
+  enabled_.store(false);
+  {
+    std::lock_guard lock(lock_);
+    stopRequested_ = true;
+  }
+  wake_.notify_one();
+  writer_.join();
+
+  // The last batch is written here rather than trusted to the writer, so
+  // it lands even if the writer is gone
+  std::vector<Pending> batch;
+  {
+    std::lock_guard lock(lock_);
+    batch.swap(pending_);
+  }
+  if (!batch.empty()) {
+    Analyze(batch);
+    WriteReport();
+  }
+}
+
+void AuditReport::WriterLoop() {
+  for (;;) {
+    std::vector<Pending> batch;
+    bool stop = false;
+    {
+      std::unique_lock lock(lock_);
+      wake_.wait(lock, [this] { return flushRequested_ || stopRequested_; });
+      batch.swap(pending_);
+      flushRequested_ = false;
+      stop = stopRequested_;
+    }
+
+    if (!batch.empty()) {
+      Analyze(batch);
+      WriteReport();
+    }
+
+    if (stop) {
+      return;
+    }
+  }
+}
+
+void AuditReport::Analyze(std::vector<Pending> &pending) {
+  auto *sanitizer = TextSanitizer::GetSingleton();
+
+  for (auto &item : pending) {
+    Entry entry{item.hook, item.formID, item.recordType, {}, {}};
+    const size_t offset = sanitizer->FindUnsupported(item.text, entry.codepoints);
+    if (offset == std::string_view::npos) {
+      continue;
+    }
+
+    // Clamp the snippet to whole UTF-8 sequences on both ends
+    size_t begin = offset > kContextRadius ? offset - kContextRadius : 0;
+    size_t end = std::min(item.text.size(), offset + kContextRadius);
+    while (begin > 0 &&
+           (static_cast<unsigned char>(item.text[begin]) & 0xC0) == 0x80) {
+      --begin;
+    }
+    while (end < item.text.size() &&
+           (static_cast<unsigned char>(item.text[end]) & 0xC0) == 0x80) {
+      ++end;
+    }
+    entry.context = item.text.substr(begin, end - begin);
+
+    entries_.push_back(std::move(entry));
+  }
+}
+
+void AuditReport::WriteReport() const {
+  std::string out;
+  out.reserve(64 + entries_.size() * 128);
+  out += "FormID,Hook,RecordType,Codepoints,Context\n";
+
+  for (const auto &entry : entries_) {
+    out += fmt::format("{:08X},{},{},", entry.formID,
+                       GetTextHookLabel(entry.hook), entry.recordType);
+
+    std::string codepoints;
+    for (auto cp : entry.codepoints) {
+      if (!codepoints.empty()) {
+        codepoints += ' ';
+      }
+      codepoints += fmt::format("U+{:04X}", cp);
+    }
+    AppendCsvField(out, codepoints);
+    out += ',';
+    AppendCsvField(out, entry.context);
+    out += '\n';
+  }
+
+  std::ofstream file(reportPath_, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    SKSE::log::warn("AuditReport: Failed to open {}", reportPath_.string());
+    return;
+  }
+  file.write(out.data(), static_cast<std::streamsize>(out.size()));
+
+  SKSE::log::info("AuditReport: Wrote {} entries to {}", entries_.size(),
+                  reportPath_.filename().string());
+}
+
+} // namespace Easy2Read
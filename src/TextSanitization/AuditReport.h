@@ -0,0 +1,99 @@
+#pragma once
+
+#include "TextSanitizer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Easy2Read {
+
+/**
+ * Structured DetectOnly audit of text with unsupported characters.
+ * Hooks only hand over a copy of the offending text; codepoint analysis and
+ * CSV output happen on a background writer thread when the game saves or
+ * quits, so reporting never does file I/O on a game thread.
+ */
+class AuditReport {
+public:
+  [[nodiscard]] static AuditReport *GetSingleton();
+
+  /**
+   * Start the writer thread.
+   * @param reportPath Destination CSV file (rewritten on every flush)
+   */
+  void Initialize(const std::filesystem::path &reportPath);
+
+  [[nodiscard]] bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Record offending text seen by a hook. Each (form, hook) pair is kept once.
+   * @param hook The hook that produced the text
+   * @param formID The owning form, or 0 if the hook has no form context
+   * @param recordType Record type label (static string, e.g. "BOOK")
+   * @param text The unmodified text
+   */
+  void Record(TextHook hook, std::uint32_t formID, std::string_view recordType,
+              std::string_view text);
+
+  // Ask the writer thread to write the report (non-blocking)
+  void Flush();
+
+  // Stop the writer thread and write what is left on the calling thread
+  void Shutdown();
+
+private:
+  AuditReport() = default;
+  ~AuditReport();
+  AuditReport(const AuditReport &) = delete;
+  AuditReport(AuditReport &&) = delete;
+  AuditReport &operator=(const AuditReport &) = delete;
+  AuditReport &operator=(AuditReport &&) = delete;
+
+  // Raw sighting captured by a hook
+  struct Pending {
+    TextHook hook;
+    std::uint32_t formID;
+    std::string_view recordType;
+    std::string text;
+  };
+
+  // Analyzed report row (writer thread only)
+  struct Entry {
+    TextHook hook;
+    std::uint32_t formID;
+    std::string_view recordType;
+    std::vector<std::uint32_t> codepoints;
+    std::string context;
+  };
+
+  void WriterLoop();
+  void Analyze(std::vector<Pending> &pending);
+  void WriteReport() const;
+
+  std::atomic<bool> enabled_{false};
+  std::filesystem::path reportPath_;
+
+  // Shared between hooks and the writer thread
+  std::mutex lock_;
+  std::condition_variable wake_;
+  std::unordered_set<std::uint64_t> seen_;
+  std::vector<Pending> pending_;
+  bool flushRequested_ = false;
+  bool stopRequested_ = false;
+
+  // Owned by the writer thread
+  std::vector<Entry> entries_;
+  std::thread writer_;
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Easy2Read::Capture {
+
+/**
+ * On-disk layout of hook traffic captures (Easy2Read_Capture.e2rcap), shared
+ * by the plugin and tools/e2r-replay. Little-endian, no padding:
+ *
+ *   FileHeader
+ *   { RecordHeader, `length` bytes of text } ...
+ *
+ * Text is stored exactly as the hook received it (no NUL terminator).
+ */
+#pragma pack(push, 1)
+struct FileHeader {
+  char magic[8];         // kMagic
+  std::uint32_t version; // kVersion
+  std::uint32_t reserved;
+};
+
+struct RecordHeader {
+  std::uint64_t timestampNs; // Since capture start
+  std::uint32_t formID;      // 0 if the hook has no form context
+  std::uint32_t length;      // Text length in bytes
+  std::uint8_t hook;         // TextHook
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(RecordHeader) == 17);
+
+inline constexpr char kMagic[8] = {'E', '2', 'R', 'C', 'A', 'P', '\0', '\0'};
+inline constexpr std::uint32_t kVersion = 1;
+
+} // namespace Easy2Read::Capture
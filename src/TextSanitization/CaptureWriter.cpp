@@ -0,0 +1,127 @@
+#include "CaptureWriter.h"
+#include "CaptureFormat.h"
+#include "PCH.h"
+#include <fstream>
+
+namespace Easy2Read {
+
+CaptureWriter *CaptureWriter::GetSingleton() {
+  static CaptureWriter singleton;
+  return &singleton;
+}
+
+void CaptureWriter::Initialize(const std::filesystem::path &capturePath) {
+  if (writer_.joinable()) {
+    return;
+  }
+
+  capturePath_ = capturePath;
+  {
+    std::ofstream file(capturePath_, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      SKSE::log::warn("CaptureWriter: Failed to create {}",
+                      capturePath_.string());
+      return;
+    }
+    Capture::FileHeader header{};
+    std::memcpy(header.magic, Capture::kMagic, sizeof(header.magic));
+    header.version = Capture::kVersion;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+
+  buffer_.reserve(kFlushThreshold * 2);
+  start_ = std::chrono::steady_clock::now();
+  writer_ = std::thread(&CaptureWriter::WriterLoop, this);
+  enabled_.store(true);
+
+  SKSE::log::info("CaptureWriter: Capturing hook traffic to {}",
+                  capturePath_.string());
+}
+
+void CaptureWriter::Record(TextHook hook, std::uint32_t formID,
+                           std::string_view text) {
+  if (!IsEnabled()) {
+    return;
+  }
+
+  Capture::RecordHeader header{};
+  header.timestampNs = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start_)
+          .count());
+  header.formID = formID;
+  header.length = static_cast<std::uint32_t>(text.size());
+  header.hook = static_cast<std::uint8_t>(hook);
+
+  bool wake = false;
+  {
+    std::lock_guard lock(lock_);
+    if (buffer_.size() + sizeof(header) + text.size() > kMaxBuffered) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    buffer_.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    buffer_.append(text);
+    wake = buffer_.size() >= kFlushThreshold;
+  }
+  records_.fetch_add(1, std::memory_order_relaxed);
+
+  if (wake) {
+    wake_.notify_one();
+  }
+}
+
+CaptureWriter::~CaptureWriter() {
+  // Only reached at process teardown without Shutdown(), when Windows has
+  // already ended the writer; joining it would never return
+  if (writer_.joinable()) {
+    writer_.detach();
+  }
+}
+
+void CaptureWriter::Shutdown() {
+  if (!writer_.joinable()) {
+    return;
+  }
+  enabled_.store(false);
+  {
+    std::lock_guard lock(lock_);
+    stopRequested_ = true;
+  }
+  wake_.notify_one();
+  writer_.join();
+
+  SKSE::log::info("CaptureWriter: Captured {} strings ({} dropped)",
+                  records_.load(), dropped_.load());
+}
+
+void CaptureWriter::WriterLoop() {
+  std::ofstream file(capturePath_, std::ios::binary | std::ios::app);
+  std::string chunk;
+  chunk.reserve(kFlushThreshold * 2);
+
+  for (;;) {
+    bool stop = false;
+    {
+      std::unique_lock lock(lock_);
+      // Also flush periodically so a crash loses at most a second of traffic
+      wake_.wait_for(lock, std::chrono::seconds(1), [this] {
+        return stopRequested_ || buffer_.size() >= kFlushThreshold;
+      });
+      chunk.swap(buffer_);
+      stop = stopRequested_;
+    }
+
+    if (!chunk.empty()) {
+      file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+      file.flush();
+      chunk.clear();
+    }
+
+    if (stop) {
+      return;
+    }
+  }
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "TextSanitizer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace Easy2Read {
+
+/**
+ * Capture mode: records every string the text hooks see, for offline
+ * benchmarking with tools/e2r-replay (format in CaptureFormat.h).
+ * Hooks only append to an in-memory buffer; a background thread writes it
+ * out in large chunks.
+ */
+class CaptureWriter {
+public:
+  [[nodiscard]] static CaptureWriter *GetSingleton();
+
+  /**
+   * Create the capture file and start the writer thread.
+   * @param capturePath Destination file (overwritten)
+   */
+  void Initialize(const std::filesystem::path &capturePath);
+
+  [[nodiscard]] bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Append one hook input to the capture.
+   * @param hook The hook that received the text
+   * @param formID The owning form, or 0 if the hook has no form context
+   * @param text The text before sanitization
+   */
+  void Record(TextHook hook, std::uint32_t formID, std::string_view text);
+
+  // Write everything buffered and stop the writer thread
+  void Shutdown();
+
+private:
+  CaptureWriter() = default;
+  ~CaptureWriter();
+  CaptureWriter(const CaptureWriter &) = delete;
+  CaptureWriter(CaptureWriter &&) = delete;
+  CaptureWriter &operator=(const CaptureWriter &) = delete;
+  CaptureWriter &operator=(CaptureWriter &&) = delete;
+
+  // Wake the writer once this much is buffered
+  static constexpr std::size_t kFlushThreshold = 256 * 1024;
+  // Drop records instead of growing the buffer past this
+  static constexpr std::size_t kMaxBuffered = 16 * 1024 * 1024;
+
+  void WriterLoop();
+
+  std::atomic<bool> enabled_{false};
+  std::filesystem::path capturePath_;
+  std::chrono::steady_clock::time_point start_;
+
+  // Shared between hooks and the writer thread
+  std::mutex lock_;
+  std::condition_variable wake_;
+  std::string buffer_;
+  bool stopRequested_ = false;
+
+  std::thread writer_;
+
+  std::atomic<std::uint64_t> records_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+};
+
+} // namespace Easy2Read
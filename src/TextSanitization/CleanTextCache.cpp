@@ -0,0 +1,116 @@
+#include "CleanTextCache.h"
+#include "PCH.h"
+#include "Utils/Hash.h"
+
+namespace Easy2Read {
+
+CleanTextCache *CleanTextCache::GetSingleton() {
+  static CleanTextCache singleton;
+  return &singleton;
+}
+
+CleanTextCache::CleanTextCache()
+    : slots_(std::make_unique<Slot[]>(kSlotCount)) {}
+
+std::uint64_t CleanTextCache::MakeKey(TextHook hook, std::uint32_t formID,
+                                      std::uint32_t discriminator) {
+  // [discriminator:24][hook:8][formID:32]; formID is never 0 for stored keys
+  return static_cast<std::uint64_t>(formID) |
+         (static_cast<std::uint64_t>(hook) << 32) |
+         (static_cast<std::uint64_t>(discriminator & 0xFFFFFF) << 40);
+}
+
+CleanTextCache::Slot *CleanTextCache::FindSlot(std::uint64_t key,
+                                               bool insert) {
+  // Mixed so the hook and discriminator bits spread a form's entries too
+  std::size_t index = HashInt(key) & (kSlotCount - 1);
+  for (std::size_t probe = 0; probe < kMaxProbe; ++probe) {
+    auto &slot = slots_[index];
+    std::uint64_t current = slot.key.load(std::memory_order_acquire);
+    if (current == key) {
+      return &slot;
+    }
+    if (current == 0) {
+      if (!insert) {
+        return nullptr;
+      }
+      if (slot.key.compare_exchange_strong(current, key,
+                                           std::memory_order_acq_rel)) {
+        entries_.fetch_add(1, std::memory_order_relaxed);
+        return &slot;
+      }
+      if (current == key) {
+        return &slot; // Another thread claimed it for the same key
+      }
+    }
+    index = (index + 1) & (kSlotCount - 1);
+  }
+
+  if (insert) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return nullptr;
+}
+
+bool CleanTextCache::IsKnownClean(TextHook hook, std::uint32_t formID,
+                                  std::uint64_t textHash,
+                                  std::uint32_t discriminator) {
+  if (formID == 0) {
+    return false;
+  }
+
+  const auto *slot = FindSlot(MakeKey(hook, formID, discriminator), false);
+  if (slot &&
+      slot->textHash.load(std::memory_order_relaxed) == StoredHash(textHash)) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void CleanTextCache::MarkClean(TextHook hook, std::uint32_t formID,
+                               std::uint64_t textHash,
+                               std::uint32_t discriminator) {
+  if (formID == 0) {
+    return;
+  }
+  if (auto *slot = FindSlot(MakeKey(hook, formID, discriminator), true)) {
+    slot->textHash.store(StoredHash(textHash), std::memory_order_relaxed);
+  }
+}
+
+void CleanTextCache::Invalidate(TextHook hook, std::uint32_t formID,
+                                std::uint32_t discriminator) {
+  if (formID == 0) {
+    return;
+  }
+  if (auto *slot = FindSlot(MakeKey(hook, formID, discriminator), false)) {
+    slot->textHash.store(0, std::memory_order_relaxed);
+  }
+}
+
+CleanTextCache::Stats CleanTextCache::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.entries = entries_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void CleanTextCache::LogStats() const {
+  const auto stats = GetStats();
+  const auto lookups = stats.hits + stats.misses;
+  const double hitRatio =
+      lookups > 0 ? 100.0 * static_cast<double>(stats.hits) /
+                        static_cast<double>(lookups)
+                  : 0.0;
+  SKSE::log::info("CleanTextCache: {} / {} slots used, {} hits / {} lookups "
+                  "({:.1f}%), {} dropped",
+                  stats.entries, kSlotCount, stats.hits, lookups, hitRatio,
+                  stats.dropped);
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "TextSanitizer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Easy2Read {
+
+/**
+ * Lock-free record of (form, hook) pairs whose text was found clean.
+ * Each slot remembers the hash of the text that was checked, so a hook only
+ * skips NeedsSanitization when the current text hashes the same; dynamic
+ * strings that change simply miss and are re-checked.
+ *
+ * Fixed-size open-addressing table with linear probing. Keys are claimed with
+ * a single CAS and never removed, so readers need no locks.
+ */
+class CleanTextCache {
+public:
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t entries = 0;
+    std::uint64_t dropped = 0; // Inserts refused because the probe ran long
+  };
+
+  [[nodiscard]] static CleanTextCache *GetSingleton();
+
+  /**
+   * Check whether text was previously found clean for this form and hook.
+   * @param hook The hook that produced the text
+   * @param formID The owning form (0 never matches)
+   * @param textHash HashText() of the current text
+   * @param discriminator Extra key bits for hooks with several texts per
+   *        form (e.g. description chunk); only the low 24 bits are used
+   */
+  [[nodiscard]] bool IsKnownClean(TextHook hook, std::uint32_t formID,
+                                  std::uint64_t textHash,
+                                  std::uint32_t discriminator = 0);
+
+  // Remember that text with this hash is clean for the form and hook
+  void MarkClean(TextHook hook, std::uint32_t formID, std::uint64_t textHash,
+                 std::uint32_t discriminator = 0);
+
+  // Forget the clean result for a form and hook (text now needs sanitizing)
+  void Invalidate(TextHook hook, std::uint32_t formID,
+                  std::uint32_t discriminator = 0);
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  CleanTextCache();
+  ~CleanTextCache() = default;
+  CleanTextCache(const CleanTextCache &) = delete;
+  CleanTextCache(CleanTextCache &&) = delete;
+  CleanTextCache &operator=(const CleanTextCache &) = delete;
+  CleanTextCache &operator=(CleanTextCache &&) = delete;
+
+  static constexpr std::size_t kSlotCount = 1 << 17; // Power of two
+  static constexpr std::size_t kMaxProbe = 32;
+
+  struct Slot {
+    std::atomic<std::uint64_t> key{0};      // 0 = empty
+    std::atomic<std::uint64_t> textHash{0}; // 0 = not clean
+  };
+
+  [[nodiscard]] static std::uint64_t MakeKey(TextHook hook,
+                                             std::uint32_t formID,
+                                             std::uint32_t discriminator);
+
+  // Stored hashes are never 0 so an empty slot never matches
+  [[nodiscard]] static std::uint64_t StoredHash(std::uint64_t textHash) {
+    return textHash | 1;
+  }
+
+  // Find the slot for a key; claim an empty one if insert is set
+  [[nodiscard]] Slot *FindSlot(std::uint64_t key, bool insert);
+
+  std::unique_ptr<Slot[]> slots_;
+
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+  std::atomic<std::uint64_t> entries_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+};
+
+} // namespace Easy2Read
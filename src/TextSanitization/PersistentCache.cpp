@@ -0,0 +1,529 @@
+#include "PersistentCache.h"
+#include "PCH.h"
+#include "StringPool.h"
+#include <bit>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Easy2Read {
+
+// ---- File formats (little-endian, native packing) ----
+
+namespace {
+constexpr char kSnapshotMagic[8] = {'E', '2', 'R', 'S', 'N', 'A', 'P', '\0'};
+constexpr char kJournalMagic[8] = {'E', '2', 'R', 'J', 'R', 'N', 'L', '\0'};
+constexpr std::uint32_t kFormatVersion = 1;
+constexpr std::uint32_t kMinSlotCount = 1024;
+
+struct SnapshotHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t slotCount; // Power of two
+  std::uint64_t fingerprint;
+  std::uint32_t entryCount;
+  std::uint32_t stringsSize; // Bytes of NUL-terminated text after the slots
+};
+static_assert(sizeof(SnapshotHeader) == 32);
+
+struct JournalHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t reserved;
+  std::uint64_t fingerprint;
+};
+static_assert(sizeof(JournalHeader) == 24);
+
+// Followed by `length` bytes of sanitized text
+struct JournalRecord {
+  std::uint64_t hash;
+  std::uint32_t sourceLength;
+  std::uint32_t length;
+};
+static_assert(sizeof(JournalRecord) == 16);
+} // namespace
+
+// Open-addressing slot; sourceLength 0 marks an empty slot (empty text is
+// never cached)
+struct PersistentCache::Slot {
+  std::uint64_t hash;
+  std::uint32_t sourceLength;
+  std::uint32_t offset; // Into the string blob
+  std::uint32_t length;
+  std::uint32_t reserved;
+};
+
+// ---- Read-only file mapping ----
+
+struct PersistentCache::MappedFile {
+  const char *data = nullptr;
+  std::size_t size = 0;
+#ifdef _WIN32
+  HANDLE file = INVALID_HANDLE_VALUE;
+  HANDLE mapping = nullptr;
+#endif
+
+  ~MappedFile() { Close(); }
+
+  bool Open(const std::filesystem::path &path) {
+#ifdef _WIN32
+    file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+      Close();
+      return false;
+    }
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+      Close();
+      return false;
+    }
+    data = static_cast<const char *>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!data) {
+      Close();
+      return false;
+    }
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+      ::close(fd);
+      return false;
+    }
+    void *view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                        PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+      return false;
+    }
+    data = static_cast<const char *>(view);
+    size = static_cast<std::size_t>(info.st_size);
+#endif
+    return true;
+  }
+
+  void Close() {
+#ifdef _WIN32
+    if (data) {
+      UnmapViewOfFile(data);
+    }
+    if (mapping) {
+      CloseHandle(mapping);
+    }
+    if (file != INVALID_HANDLE_VALUE) {
+      CloseHandle(file);
+    }
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (data) {
+      ::munmap(const_cast<char *>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+  }
+};
+
+// ---- PersistentCache ----
+
+PersistentCache *PersistentCache::GetSingleton() {
+  static PersistentCache singleton;
+  return &singleton;
+}
+
+PersistentCache::PersistentCache() : mapping_(std::make_unique<MappedFile>()) {
+  static_assert(sizeof(Slot) == 24, "snapshot slot layout changed");
+  // Journal entries point into the pool; constructing it first makes it
+  // outlive this singleton
+  (void)StringPool::GetSingleton();
+}
+
+PersistentCache::~PersistentCache() {
+  // Normally already closed when the game quits; this covers a teardown
+  // that skipped the quit hook
+  Close();
+}
+
+void PersistentCache::Open(const std::filesystem::path &directory,
+                           std::uint64_t fingerprint) {
+  if (IsOpen()) {
+    return;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec) {
+    SKSE::log::warn("PersistentCache: Cannot create {}: {}", directory.string(),
+                    ec.message());
+    return;
+  }
+
+  snapshotPath_ = directory / "SanitizedCache.bin";
+  journalPath_ = directory / "SanitizedCache.journal";
+  pendingPath_ = directory / "SanitizedCache.new";
+  fingerprint_ = fingerprint;
+
+  PromotePendingSnapshot();
+  if (!MapSnapshot() && std::filesystem::exists(snapshotPath_, ec)) {
+    std::filesystem::remove(snapshotPath_, ec);
+  }
+  LoadJournal();
+  open_.store(true, std::memory_order_release);
+
+  SKSE::log::info("PersistentCache: {} cached strings ({} from journal), "
+                  "fingerprint {:016X}",
+                  snapshotEntries_ + journal_.size(), journal_.size(),
+                  fingerprint_);
+}
+
+void PersistentCache::PromotePendingSnapshot() {
+  std::error_code ec;
+  if (!std::filesystem::exists(pendingPath_, ec)) {
+    return;
+  }
+  // Nothing is mapped yet, so the old snapshot can be replaced now. The new
+  // one already holds the journal.
+  std::filesystem::rename(pendingPath_, snapshotPath_, ec);
+  if (ec) {
+    SKSE::log::warn("PersistentCache: Failed to replace {}: {}",
+                    snapshotPath_.string(), ec.message());
+    std::filesystem::remove(pendingPath_, ec);
+    return;
+  }
+  std::filesystem::remove(journalPath_, ec);
+}
+
+bool PersistentCache::MapSnapshot() {
+  if (!mapping_->Open(snapshotPath_)) {
+    return false;
+  }
+
+  SnapshotHeader header{};
+  bool valid = mapping_->size >= sizeof(header);
+  if (valid) {
+    std::memcpy(&header, mapping_->data, sizeof(header));
+    valid = std::memcmp(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) ==
+                0 &&
+            header.version == kFormatVersion &&
+            std::has_single_bit(header.slotCount) &&
+            mapping_->size >= sizeof(header) +
+                                  std::size_t{header.slotCount} * sizeof(Slot) +
+                                  header.stringsSize;
+  }
+  if (!valid) {
+    SKSE::log::warn("PersistentCache: {} is damaged, rebuilding",
+                    snapshotPath_.filename().string());
+    mapping_->Close();
+    return false;
+  }
+  if (header.fingerprint != fingerprint_) {
+    SKSE::log::info("PersistentCache: Load order or sanitizer settings "
+                    "changed, rebuilding");
+    mapping_->Close();
+    return false;
+  }
+
+  slots_ = reinterpret_cast<const Slot *>(mapping_->data + sizeof(header));
+  slotMask_ = header.slotCount - 1;
+  strings_ = mapping_->data + sizeof(header) +
+             std::size_t{header.slotCount} * sizeof(Slot);
+  stringsSize_ = header.stringsSize;
+  snapshotEntries_ = header.entryCount;
+  return true;
+}
+
+void PersistentCache::LoadJournal() {
+  std::error_code ec;
+  if (!std::filesystem::exists(journalPath_, ec)) {
+    return;
+  }
+
+  std::string data;
+  {
+    std::ifstream file(journalPath_, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+  }
+
+  JournalHeader header{};
+  if (data.size() < sizeof(header)) {
+    std::filesystem::remove(journalPath_, ec);
+    return;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, kJournalMagic, sizeof(kJournalMagic)) != 0 ||
+      header.version != kFormatVersion || header.fingerprint != fingerprint_) {
+    std::filesystem::remove(journalPath_, ec);
+    return;
+  }
+
+  auto *pool = StringPool::GetSingleton();
+  std::size_t pos = sizeof(header);
+  while (pos + sizeof(JournalRecord) <= data.size()) {
+    JournalRecord record{};
+    std::memcpy(&record, data.data() + pos, sizeof(record));
+    if (record.sourceLength == 0 ||
+        data.size() - pos - sizeof(record) < record.length) {
+      break;
+    }
+    const std::string_view text(data.data() + pos + sizeof(record),
+                                record.length);
+    journal_.insert_or_assign(
+        record.hash, JournalEntry{record.sourceLength, pool->Intern(text)});
+    pos += sizeof(record) + record.length;
+  }
+
+  // Drop a record torn by a crash so later appends stay readable
+  if (pos != data.size()) {
+    std::filesystem::resize_file(journalPath_, pos, ec);
+  }
+}
+
+std::optional<std::string_view>
+PersistentCache::FindInSnapshot(std::uint64_t hash, std::size_t length) const {
+  if (!slots_) {
+    return std::nullopt;
+  }
+  std::uint32_t index = static_cast<std::uint32_t>(hash) & slotMask_;
+  for (std::uint32_t probe = 0; probe <= slotMask_; ++probe) {
+    const Slot &slot = slots_[index];
+    if (slot.sourceLength == 0) {
+      break;
+    }
+    if (slot.hash == hash && slot.sourceLength == length) {
+      // Bounds-check against a damaged file; the text must end in a NUL
+      if (slot.offset >= stringsSize_ ||
+          stringsSize_ - slot.offset <= slot.length) {
+        break;
+      }
+      return std::string_view(strings_ + slot.offset, slot.length);
+    }
+    index = (index + 1) & slotMask_;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string_view> PersistentCache::Lookup(std::uint64_t hash,
+                                                        std::size_t length) {
+  if (!IsOpen()) {
+    return std::nullopt;
+  }
+  if (auto found = FindInSnapshot(hash, length)) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return found;
+  }
+  {
+    std::shared_lock lock(lock_);
+    auto it = journal_.find(hash);
+    if (it != journal_.end() && it->second.sourceLength == length) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return it->second.sanitized;
+    }
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+void PersistentCache::Append(std::uint64_t hash, std::size_t length,
+                             std::string_view sanitized) {
+  if (!IsOpen() || length == 0 || length > UINT32_MAX ||
+      sanitized.size() > UINT32_MAX || FindInSnapshot(hash, length)) {
+    return;
+  }
+
+  JournalRecord record{};
+  record.hash = hash;
+  record.sourceLength = static_cast<std::uint32_t>(length);
+  record.length = static_cast<std::uint32_t>(sanitized.size());
+
+  std::unique_lock lock(lock_);
+  if (journal_.size() >= kMaxEntries) {
+    return;
+  }
+  auto [it, inserted] =
+      journal_.try_emplace(hash, JournalEntry{record.sourceLength, sanitized});
+  if (!inserted) {
+    if (it->second.sourceLength == length) {
+      return;
+    }
+    it->second = JournalEntry{record.sourceLength, sanitized};
+  }
+  pending_.append(reinterpret_cast<const char *>(&record), sizeof(record));
+  pending_.append(sanitized);
+}
+
+void PersistentCache::Flush() {
+  std::string data;
+  {
+    std::unique_lock lock(lock_);
+    data.swap(pending_);
+  }
+  if (data.empty()) {
+    return;
+  }
+
+  std::lock_guard fileLock(fileLock_);
+  std::error_code ec;
+  const bool needsHeader = !std::filesystem::exists(journalPath_, ec) ||
+                           std::filesystem::file_size(journalPath_, ec) == 0;
+  std::ofstream file(journalPath_, std::ios::binary | std::ios::app);
+  if (!file) {
+    SKSE::log::warn("PersistentCache: Failed to open {}",
+                    journalPath_.string());
+    return;
+  }
+  if (needsHeader) {
+    JournalHeader header{};
+    std::memcpy(header.magic, kJournalMagic, sizeof(header.magic));
+    header.version = kFormatVersion;
+    header.fingerprint = fingerprint_;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+  file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void PersistentCache::Close() {
+  if (!IsOpen()) {
+    return;
+  }
+  Flush();
+  open_.store(false, std::memory_order_release);
+
+  // The snapshot stays mapped: game threads may still hold views into it
+  // (DescriptionCache, SanitizedTextCache) or be inside FindInSnapshot. The
+  // process exit unmaps it.
+  std::unique_lock lock(lock_);
+  if (!journal_.empty()) {
+    WriteSnapshot();
+  }
+}
+
+void PersistentCache::WriteSnapshot() {
+  struct Item {
+    std::uint64_t hash;
+    std::uint32_t sourceLength;
+    std::string_view text;
+  };
+
+  // Journal entries are newer; they replace snapshot entries with the same hash
+  std::vector<Item> items;
+  items.reserve(snapshotEntries_ + journal_.size());
+  if (slots_) {
+    for (std::uint32_t i = 0; i <= slotMask_; ++i) {
+      const Slot &slot = slots_[i];
+      if (slot.sourceLength == 0 || journal_.contains(slot.hash)) {
+        continue;
+      }
+      if (auto text = FindInSnapshot(slot.hash, slot.sourceLength)) {
+        items.push_back(Item{slot.hash, slot.sourceLength, *text});
+      }
+    }
+  }
+  for (const auto &[hash, entry] : journal_) {
+    items.push_back(Item{hash, entry.sourceLength, entry.sanitized});
+  }
+
+  const auto slotCount = std::bit_ceil((std::max)(
+      static_cast<std::uint32_t>(items.size() * 2), kMinSlotCount));
+  std::vector<Slot> slots(slotCount);
+  std::string strings;
+  std::uint32_t entryCount = 0;
+  for (const auto &item : items) {
+    if (entryCount >= kMaxEntries ||
+        strings.size() + item.text.size() + 1 > kMaxStringBytes) {
+      break;
+    }
+    std::uint32_t index = static_cast<std::uint32_t>(item.hash) & (slotCount - 1);
+    while (slots[index].sourceLength != 0) {
+      index = (index + 1) & (slotCount - 1);
+    }
+    slots[index] = Slot{item.hash, item.sourceLength,
+                        static_cast<std::uint32_t>(strings.size()),
+                        static_cast<std::uint32_t>(item.text.size()), 0};
+    strings.append(item.text);
+    strings.push_back('\0');
+    ++entryCount;
+  }
+
+  SnapshotHeader header{};
+  std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+  header.version = kFormatVersion;
+  header.slotCount = slotCount;
+  header.fingerprint = fingerprint_;
+  header.entryCount = entryCount;
+  header.stringsSize = static_cast<std::uint32_t>(strings.size());
+
+  auto tempPath = snapshotPath_;
+  tempPath += ".tmp";
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(slots.data()),
+               static_cast<std::streamsize>(slots.size() * sizeof(Slot)));
+    file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    if (!file) {
+      SKSE::log::warn("PersistentCache: Failed to write {}",
+                      tempPath.string());
+      return;
+    }
+  }
+
+  // A mapped file can't be replaced on Windows, so the complete snapshot
+  // waits under its own name until the next launch maps it
+  std::error_code ec;
+  std::filesystem::rename(tempPath, pendingPath_, ec);
+  if (ec) {
+    SKSE::log::warn("PersistentCache: Failed to write {}: {}",
+                    pendingPath_.string(), ec.message());
+    std::filesystem::remove(tempPath, ec);
+    return;
+  }
+
+  SKSE::log::info("PersistentCache: Compacted {} strings ({} KB) into {}, "
+                  "used from the next launch",
+                  entryCount, strings.size() / 1024,
+                  pendingPath_.filename().string());
+}
+
+PersistentCache::Stats PersistentCache::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.snapshotEntries = slots_ ? snapshotEntries_ : 0;
+  stats.mappedBytes = mapping_->size;
+  std::shared_lock lock(lock_);
+  stats.journalEntries = journal_.size();
+  return stats;
+}
+
+void PersistentCache::LogStats() const {
+  const auto stats = GetStats();
+  const auto lookups = stats.hits + stats.misses;
+  const double hitRatio =
+      lookups > 0 ? 100.0 * static_cast<double>(stats.hits) /
+                        static_cast<double>(lookups)
+                  : 0.0;
+  SKSE::log::info("PersistentCache: {} mapped + {} new entries ({} KB mapped), "
+                  "{} hits / {} lookups ({:.1f}%)",
+                  stats.snapshotEntries, stats.journalEntries,
+                  stats.mappedBytes / 1024, stats.hits, lookups, hitRatio);
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Easy2Read {
+
+/**
+ * Sanitized text kept across game launches.
+ *
+ * A snapshot file maps HashText() of the original text (plus its length) to
+ * the sanitized text. It is memory-mapped read-only at startup and probed in
+ * place, so lookups never allocate. Results found during play are appended to
+ * a journal file and merged into a new snapshot when the game exits; the new
+ * snapshot replaces the mapped one at the next launch.
+ *
+ * Both files carry a fingerprint of the load order and the sanitizer
+ * configuration; on mismatch the cache starts empty.
+ */
+class PersistentCache {
+public:
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t snapshotEntries = 0; // Entries in the mapped snapshot
+    std::uint64_t journalEntries = 0;  // Entries added since the snapshot
+    std::uint64_t mappedBytes = 0;
+  };
+
+  [[nodiscard]] static PersistentCache *GetSingleton();
+
+  /**
+   * Map the snapshot and replay the journal found in a directory.
+   * @param directory Folder holding the cache files (created if missing)
+   * @param fingerprint Load order and sanitizer fingerprint; stale files are
+   *        deleted
+   */
+  void Open(const std::filesystem::path &directory, std::uint64_t fingerprint);
+
+  [[nodiscard]] bool IsOpen() const {
+    return open_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Find the sanitized form of a text. Does not allocate.
+   * @return A NUL-terminated view valid for the rest of the session, or
+   *         nullopt
+   */
+  [[nodiscard]] std::optional<std::string_view> Lookup(std::uint64_t hash,
+                                                       std::size_t length);
+
+  /**
+   * Remember a sanitized result for the next launch.
+   * @param sanitized Must be a StringPool view (kept by reference)
+   */
+  void Append(std::uint64_t hash, std::size_t length,
+              std::string_view sanitized);
+
+  // Write pending journal records to disk (safe from a worker thread)
+  void Flush();
+
+  // Flush and merge the journal into a new snapshot for the next launch.
+  // Views handed out stay valid. Called when the game quits, and from the
+  // destructor if that was missed.
+  void Close();
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  PersistentCache();
+  ~PersistentCache();
+  PersistentCache(const PersistentCache &) = delete;
+  PersistentCache(PersistentCache &&) = delete;
+  PersistentCache &operator=(const PersistentCache &) = delete;
+  PersistentCache &operator=(PersistentCache &&) = delete;
+
+  struct MappedFile;
+  struct Slot;
+
+  struct JournalEntry {
+    std::uint32_t sourceLength;
+    std::string_view sanitized;
+  };
+
+  // Move a snapshot compacted by the last session into place
+  void PromotePendingSnapshot();
+  [[nodiscard]] bool MapSnapshot();
+  void LoadJournal();
+  [[nodiscard]] std::optional<std::string_view>
+  FindInSnapshot(std::uint64_t hash, std::size_t length) const;
+  void WriteSnapshot();
+
+  static constexpr std::size_t kMaxEntries = 1u << 20;
+  static constexpr std::size_t kMaxStringBytes = 64u * 1024 * 1024;
+
+  std::filesystem::path snapshotPath_;
+  std::filesystem::path journalPath_;
+  std::filesystem::path pendingPath_; // Compacted, replaces the snapshot
+  std::uint64_t fingerprint_ = 0;
+
+  // Snapshot: immutable while open, read without locking
+  std::unique_ptr<MappedFile> mapping_;
+  const Slot *slots_ = nullptr;
+  std::uint32_t slotMask_ = 0;
+  const char *strings_ = nullptr;
+  std::uint32_t stringsSize_ = 0;
+  std::uint32_t snapshotEntries_ = 0;
+
+  // Journal: entries added since the snapshot was written
+  mutable std::shared_mutex lock_;
+  std::unordered_map<std::uint64_t, JournalEntry> journal_;
+  std::string pending_; // Serialized records not yet written
+  std::mutex fileLock_; // Serializes journal writes
+
+  std::atomic<bool> open_{false};
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,100 @@
+#include "SanitizedTextCache.h"
+#include "PCH.h"
+#include "PersistentCache.h"
+#include "TextSanitizer.h"
+#include "Utils/Hash.h"
+
+namespace Easy2Read {
+
+SanitizedTextCache *SanitizedTextCache::GetSingleton() {
+  static SanitizedTextCache singleton;
+  return &singleton;
+}
+
+std::optional<SanitizedTextCache::Hit>
+SanitizedTextCache::Lookup(std::uint64_t hash, std::size_t length) {
+  const auto &shard = shards_[hash % kShardCount];
+  {
+    std::shared_lock lock(shard.lock);
+    auto it = shard.entries.find(hash);
+    if (it != shard.entries.end() && it->second.length == length) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return Hit{it->second.clean, it->second.sanitized};
+    }
+  }
+  if (auto stored = PersistentCache::GetSingleton()->Lookup(hash, length)) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return Hit{false, *stored};
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+bool SanitizedTextCache::Contains(std::uint64_t hash,
+                                  std::size_t length) const {
+  const auto &shard = shards_[hash % kShardCount];
+  std::shared_lock lock(shard.lock);
+  auto it = shard.entries.find(hash);
+  return it != shard.entries.end() && it->second.length == length;
+}
+
+void SanitizedTextCache::StoreClean(std::uint64_t hash, std::size_t length) {
+  Store(hash, Entry{length, true, {}});
+}
+
+void SanitizedTextCache::StoreSanitized(std::uint64_t hash,
+                                        std::size_t length,
+                                        std::string_view sanitized) {
+  Store(hash, Entry{length, false, sanitized});
+  PersistentCache::GetSingleton()->Append(hash, length, sanitized);
+}
+
+void SanitizedTextCache::Prefetch(std::string_view text) {
+  const std::uint64_t hash = HashText(text);
+  if (text.empty() || Contains(hash, text.size())) {
+    return;
+  }
+
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  if (!sanitizer->NeedsSanitization(text)) {
+    StoreClean(hash, text.size());
+  } else if (sanitizer->GetMode() != SanitizationMode::DetectOnly) {
+    StoreSanitized(hash, text.size(), sanitizer->SanitizeInterned(text));
+  }
+}
+
+void SanitizedTextCache::Store(std::uint64_t hash, const Entry &entry) {
+  auto &shard = shards_[hash % kShardCount];
+  std::unique_lock lock(shard.lock);
+  if (shard.entries.size() >= kMaxEntriesPerShard &&
+      !shard.entries.contains(hash)) {
+    // Dialogue text churns per conversation; start the shard over
+    shard.entries.clear();
+  }
+  shard.entries.insert_or_assign(hash, entry);
+}
+
+SanitizedTextCache::Stats SanitizedTextCache::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  for (const auto &shard : shards_) {
+    std::shared_lock lock(shard.lock);
+    stats.entries += shard.entries.size();
+  }
+  return stats;
+}
+
+void SanitizedTextCache::LogStats() const {
+  const auto stats = GetStats();
+  const auto lookups = stats.hits + stats.misses;
+  const double hitRatio =
+      lookups > 0 ? 100.0 * static_cast<double>(stats.hits) /
+                        static_cast<double>(lookups)
+                  : 0.0;
+  SKSE::log::info("SanitizedTextCache: {} entries, {} hits / {} lookups "
+                  "({:.1f}%)",
+                  stats.entries, stats.hits, lookups, hitRatio);
+}
+
+} // namespace Easy2Read
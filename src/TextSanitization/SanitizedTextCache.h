@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace Easy2Read {
+
+/**
+ * Content-addressed cache of sanitizer results, for hooks whose text has no
+ * stable form identity (dialogue menu options, dialogue responses).
+ * Keyed by HashText() of the original text plus its length; stores either
+ * "clean" or a view of the pooled sanitized text. Filled by the hooks on a
+ * miss and ahead of time by background prefetch. Sanitized results are also
+ * kept in the PersistentCache for later launches.
+ */
+class SanitizedTextCache {
+public:
+  struct Hit {
+    bool clean;                 // Text needs no changes
+    std::string_view sanitized; // Pooled sanitized text (if not clean)
+  };
+
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t entries = 0;
+  };
+
+  [[nodiscard]] static SanitizedTextCache *GetSingleton();
+
+  [[nodiscard]] std::optional<Hit> Lookup(std::uint64_t hash,
+                                          std::size_t length);
+
+  // Check for an entry without counting it as a lookup (for prefetch)
+  [[nodiscard]] bool Contains(std::uint64_t hash, std::size_t length) const;
+
+  // Remember that the text with this hash needs no changes
+  void StoreClean(std::uint64_t hash, std::size_t length);
+
+  // Remember the sanitized form (must be a StringPool view); also persisted
+  void StoreSanitized(std::uint64_t hash, std::size_t length,
+                      std::string_view sanitized);
+
+  /**
+   * Check and, if needed, sanitize a text into the cache unless an entry
+   * already exists. For prefetch workers; the text is not modified.
+   */
+  void Prefetch(std::string_view text);
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  SanitizedTextCache() = default;
+  ~SanitizedTextCache() = default;
+  SanitizedTextCache(const SanitizedTextCache &) = delete;
+  SanitizedTextCache(SanitizedTextCache &&) = delete;
+  SanitizedTextCache &operator=(const SanitizedTextCache &) = delete;
+  SanitizedTextCache &operator=(SanitizedTextCache &&) = delete;
+
+  static constexpr std::size_t kShardCount = 16;
+  static constexpr std::size_t kMaxEntriesPerShard = 4096;
+
+  struct Entry {
+    std::size_t length;
+    bool clean;
+    std::string_view sanitized;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex lock;
+    std::unordered_map<std::uint64_t, Entry> entries;
+  };
+
+  void Store(std::uint64_t hash, const Entry &entry);
+
+  std::array<Shard, kShardCount> shards_;
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#define E2R_HAS_X86_SIMD 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define E2R_TARGET_AVX2
+#else
+#define E2R_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Easy2Read {
+
+/**
+ * Translation table for strings in a single-byte encoding (CP1252/Latin-1).
+ * Every byte maps to a short output sequence. Bytes whose output differs from
+ * the byte itself are "special"; they are classified with two 16-entry nibble
+ * tables so the AVX2 kernel can test 32 bytes per step with pshufb.
+ */
+struct SingleByteTable {
+  struct Entry {
+    char bytes[7];
+    std::uint8_t length;
+  };
+
+  std::array<Entry, 256> entries{};
+  alignas(16) std::array<std::uint8_t, 16> loNibble{};
+  alignas(16) std::array<std::uint8_t, 16> hiNibble{};
+
+  // Reset to identity (every byte maps to itself, nothing special)
+  void Reset() {
+    for (unsigned b = 0; b < 256; ++b) {
+      entries[b].bytes[0] = static_cast<char>(b);
+      entries[b].length = 1;
+    }
+    loNibble.fill(0);
+    for (unsigned h = 0; h < 16; ++h) {
+      // One class bit per high nibble 8-F; ASCII is never special
+      hiNibble[h] = h >= 8 ? static_cast<std::uint8_t>(1u << (h - 8)) : 0;
+    }
+  }
+
+  // Map a high byte (>= 0x80) to a replacement of at most 7 bytes
+  void Set(std::uint8_t b, std::string_view replacement) {
+    auto &entry = entries[b];
+    entry.length = static_cast<std::uint8_t>(
+        replacement.size() < sizeof(entry.bytes) ? replacement.size()
+                                                 : sizeof(entry.bytes));
+    std::memcpy(entry.bytes, replacement.data(), entry.length);
+
+    const bool identity =
+        entry.length == 1 && static_cast<std::uint8_t>(entry.bytes[0]) == b;
+    const auto bit = static_cast<std::uint8_t>(1u << ((b >> 4) - 8));
+    if (identity) {
+      loNibble[b & 0x0F] &= static_cast<std::uint8_t>(~bit);
+    } else {
+      loNibble[b & 0x0F] |= bit;
+    }
+  }
+
+  [[nodiscard]] bool IsSpecial(std::uint8_t b) const {
+    return (loNibble[b & 0x0F] & hiNibble[b >> 4]) != 0;
+  }
+};
+
+/**
+ * Length of a strictly valid UTF-8 multibyte sequence starting at input[i],
+ * or 0 if the bytes there are not one.
+ */
+[[nodiscard]] inline size_t ValidUtf8SequenceLength(std::string_view input,
+                                                    size_t i) {
+  auto at = [&](size_t k) { return static_cast<unsigned char>(input[k]); };
+  auto cont = [&](size_t k) {
+    return k < input.size() && (at(k) & 0xC0) == 0x80;
+  };
+
+  const unsigned char c = at(i);
+  if (c >= 0xC2 && c <= 0xDF) {
+    return cont(i + 1) ? 2 : 0;
+  }
+  if (c >= 0xE0 && c <= 0xEF) {
+    if (!cont(i + 1) || !cont(i + 2)) {
+      return 0;
+    }
+    const unsigned char c1 = at(i + 1);
+    if ((c == 0xE0 && c1 < 0xA0) || (c == 0xED && c1 > 0x9F)) {
+      return 0; // Overlong or surrogate
+    }
+    return 3;
+  }
+  if (c >= 0xF0 && c <= 0xF4) {
+    if (!cont(i + 1) || !cont(i + 2) || !cont(i + 3)) {
+      return 0;
+    }
+    const unsigned char c1 = at(i + 1);
+    if ((c == 0xF0 && c1 < 0x90) || (c == 0xF4 && c1 > 0x8F)) {
+      return 0; // Overlong or beyond U+10FFFF
+    }
+    return 4;
+  }
+  return 0;
+}
+
+/**
+ * A string is single-byte encoded if it has bytes >= 0x80 but not a single
+ * valid UTF-8 multibyte sequence. Mixed strings stay on the UTF-8 path.
+ */
+[[nodiscard]] inline bool IsSingleByteEncoded(std::string_view input) {
+  bool sawHighByte = false;
+  size_t i = 0;
+  while (i < input.size()) {
+    // Skip ASCII 8 bytes at a time
+    if (i + 8 <= input.size()) {
+      std::uint64_t word;
+      std::memcpy(&word, input.data() + i, 8);
+      if ((word & 0x8080808080808080ull) == 0) {
+        i += 8;
+        continue;
+      }
+    }
+
+    if (static_cast<unsigned char>(input[i]) < 0x80) {
+      ++i;
+      continue;
+    }
+
+    if (ValidUtf8SequenceLength(input, i) != 0) {
+      return false;
+    }
+    sawHighByte = true;
+    ++i;
+  }
+  return sawHighByte;
+}
+
+namespace detail {
+template <class Sink>
+void TranslateSingleByteScalar(const char *data, size_t size, size_t i,
+                               size_t runStart, const SingleByteTable &table,
+                               Sink &sink) {
+  for (; i < size; ++i) {
+    const auto b = static_cast<std::uint8_t>(data[i]);
+    if (!table.IsSpecial(b)) {
+      continue;
+    }
+    sink.Append(data + runStart, i - runStart);
+    sink.Append(table.entries[b].bytes, table.entries[b].length);
+    runStart = i + 1;
+  }
+  sink.Append(data + runStart, size - runStart);
+}
+
+#ifdef E2R_HAS_X86_SIMD
+template <class Sink>
+E2R_TARGET_AVX2 void TranslateSingleByteAVX2(const char *data, size_t size,
+                                             const SingleByteTable &table,
+                                             Sink &sink) {
+  const __m256i loTable = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(table.loNibble.data())));
+  const __m256i hiTable = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(table.hiNibble.data())));
+  const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+  const __m256i zero = _mm256_setzero_si256();
+
+  size_t i = 0;
+  size_t runStart = 0; // Start of the pending plain run
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+    const __m256i lo =
+        _mm256_shuffle_epi8(loTable, _mm256_and_si256(v, nibbleMask));
+    const __m256i hi = _mm256_shuffle_epi8(
+        hiTable, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibbleMask));
+    const __m256i plain = _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), zero);
+
+    auto special =
+        ~static_cast<std::uint32_t>(_mm256_movemask_epi8(plain));
+    while (special != 0) {
+      const size_t pos = i + static_cast<size_t>(std::countr_zero(special));
+      const auto b = static_cast<std::uint8_t>(data[pos]);
+      sink.Append(data + runStart, pos - runStart);
+      sink.Append(table.entries[b].bytes, table.entries[b].length);
+      runStart = pos + 1;
+      special &= special - 1;
+    }
+  }
+
+  TranslateSingleByteScalar(data, size, i, runStart, table, sink);
+}
+#endif
+
+[[nodiscard]] inline bool CpuHasAVX2() {
+#ifdef E2R_HAS_X86_SIMD
+#if defined(_MSC_VER) && !defined(__clang__)
+  static const bool hasAVX2 = [] {
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+      return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+      return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+  }();
+  return hasAVX2;
+#else
+  static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+  return hasAVX2;
+#endif
+#else
+  return false;
+#endif
+}
+} // namespace detail
+
+/**
+ * Translate a single-byte encoded string through the table.
+ * Plain runs are forwarded to the sink in one piece; only special bytes are
+ * looked up individually. Sink must provide Append(const char*, size_t).
+ */
+template <class Sink>
+void TranslateSingleByte(std::string_view input, const SingleByteTable &table,
+                         Sink &sink) {
+#ifdef E2R_HAS_X86_SIMD
+  if (input.size() >= 32 && detail::CpuHasAVX2()) {
+    detail::TranslateSingleByteAVX2(input.data(), input.size(), table, sink);
+    return;
+  }
+#endif
+  detail::TranslateSingleByteScalar(input.data(), input.size(), 0, 0, table,
+                                    sink);
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,124 @@
+#include "StringPool.h"
+#include "PCH.h"
+#include "Utils/Hash.h"
+
+namespace Easy2Read {
+
+StringPool *StringPool::GetSingleton() {
+  static StringPool singleton;
+  return &singleton;
+}
+
+std::string_view StringPool::Shard::Store(std::string_view text) {
+  const std::size_t needed = text.size() + 1; // Keep a NUL terminator
+
+  char *dest = nullptr;
+  if (needed > kPageSize / 4) {
+    // Large strings get a dedicated page so they don't waste arena space
+    pages.push_back(std::make_unique<char[]>(needed));
+    dest = pages.back().get();
+    reservedBytes += needed;
+  } else {
+    if (needed > remaining) {
+      pages.push_back(std::make_unique<char[]>(kPageSize));
+      cursor = pages.back().get();
+      remaining = kPageSize;
+      reservedBytes += kPageSize;
+    }
+    dest = cursor;
+    cursor += needed;
+    remaining -= needed;
+  }
+
+  std::memcpy(dest, text.data(), text.size());
+  dest[text.size()] = '\0';
+  storedBytes += needed;
+
+  return std::string_view(dest, text.size());
+}
+
+std::string_view StringPool::Intern(std::string_view text) {
+  return Intern(text, HashText(text));
+}
+
+std::string_view StringPool::Intern(std::string_view text,
+                                    std::uint64_t hash) {
+  auto &shard = ShardFor(hash);
+  shard.internCalls.fetch_add(1, std::memory_order_relaxed);
+  shard.requestedBytes.fetch_add(text.size(), std::memory_order_relaxed);
+
+  // Fast path: already pooled (shared lock only)
+  {
+    std::shared_lock lock(shard.lock);
+    auto [first, last] = shard.entries.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+      if (it->second == text) {
+        return it->second;
+      }
+    }
+  }
+
+  std::unique_lock lock(shard.lock);
+
+  // Re-check: another thread may have inserted it while we waited
+  auto [first, last] = shard.entries.equal_range(hash);
+  for (auto it = first; it != last; ++it) {
+    if (it->second == text) {
+      return it->second;
+    }
+  }
+
+  auto stored = shard.Store(text);
+  shard.entries.emplace(hash, stored);
+  return stored;
+}
+
+std::string_view StringPool::Find(std::string_view text,
+                                  std::uint64_t hash) const {
+  const auto &shard = ShardFor(hash);
+  std::shared_lock lock(shard.lock);
+  auto [first, last] = shard.entries.equal_range(hash);
+  for (auto it = first; it != last; ++it) {
+    if (it->second == text) {
+      return it->second;
+    }
+  }
+  return {};
+}
+
+StringPool::Stats StringPool::GetStats() const {
+  Stats stats;
+  for (const auto &shard : shards_) {
+    std::shared_lock lock(shard.lock);
+    stats.internCalls += shard.internCalls.load(std::memory_order_relaxed);
+    stats.uniqueStrings += shard.entries.size();
+    stats.requestedBytes +=
+        shard.requestedBytes.load(std::memory_order_relaxed);
+    stats.storedBytes += shard.storedBytes;
+    stats.reservedBytes += shard.reservedBytes;
+    stats.pageCount += shard.pages.size();
+  }
+  return stats;
+}
+
+void StringPool::LogStats() const {
+  const auto stats = GetStats();
+  if (stats.uniqueStrings == 0) {
+    SKSE::log::info("StringPool: empty");
+    return;
+  }
+
+  const double dedupRatio =
+      stats.storedBytes > 0
+          ? static_cast<double>(stats.requestedBytes + stats.internCalls) /
+                static_cast<double>(stats.storedBytes)
+          : 1.0;
+
+  SKSE::log::info("StringPool: {} unique strings from {} interns, {} KB "
+                  "stored / {} KB reserved in {} pages, dedup ratio {:.2f}x",
+                  stats.uniqueStrings, stats.internCalls,
+                  stats.storedBytes / 1024, stats.reservedBytes / 1024,
+                  stats.pageCount, dedupRatio);
+}
+
+} // namespace Easy2Read
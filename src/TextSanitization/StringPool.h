@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Easy2Read {
+
+/**
+ * Global, append-only pool of interned strings.
+ * Each distinct string is stored once in large arena pages and handed out as a
+ * stable, NUL-terminated view that stays valid for the lifetime of the plugin.
+ * Lookups are sharded by content hash so concurrent hooks rarely contend.
+ */
+class StringPool {
+public:
+  struct Stats {
+    std::uint64_t internCalls = 0;    // Total Intern() calls
+    std::uint64_t uniqueStrings = 0;  // Distinct strings stored
+    std::uint64_t requestedBytes = 0; // Bytes passed to Intern() in total
+    std::uint64_t storedBytes = 0;    // Bytes actually stored (incl. NULs)
+    std::uint64_t reservedBytes = 0;  // Bytes reserved in arena pages
+    std::uint64_t pageCount = 0;      // Number of arena pages
+  };
+
+  [[nodiscard]] static StringPool *GetSingleton();
+
+  /**
+   * Intern a string.
+   * @param text The content to intern
+   * @return A stable view of the pooled copy (NUL-terminated)
+   */
+  [[nodiscard]] std::string_view Intern(std::string_view text);
+
+  /**
+   * Intern a string whose content hash has already been computed.
+   */
+  [[nodiscard]] std::string_view Intern(std::string_view text,
+                                        std::uint64_t hash);
+
+  /**
+   * Look up a string without inserting it.
+   * @return The pooled view, or an empty view with nullptr data if absent
+   */
+  [[nodiscard]] std::string_view Find(std::string_view text,
+                                      std::uint64_t hash) const;
+
+  [[nodiscard]] Stats GetStats() const;
+
+  // Write memory use and dedup ratio to the log
+  void LogStats() const;
+
+private:
+  StringPool() = default;
+  ~StringPool() = default;
+  StringPool(const StringPool &) = delete;
+  StringPool(StringPool &&) = delete;
+  StringPool &operator=(const StringPool &) = delete;
+  StringPool &operator=(StringPool &&) = delete;
+
+  static constexpr std::size_t kShardCount = 16;
+  static constexpr std::size_t kPageSize = 64 * 1024;
+
+  struct Shard {
+    mutable std::shared_mutex lock;
+    std::unordered_multimap<std::uint64_t, std::string_view> entries;
+    std::vector<std::unique_ptr<char[]>> pages;
+    char *cursor = nullptr;    // Next free byte in the current page
+    std::size_t remaining = 0; // Free bytes left in the current page
+
+    std::atomic<std::uint64_t> internCalls{0};
+    std::atomic<std::uint64_t> requestedBytes{0};
+    std::uint64_t storedBytes = 0;
+    std::uint64_t reservedBytes = 0;
+
+    // Copy text into the arena (caller holds the unique lock)
+    std::string_view Store(std::string_view text);
+  };
+
+  [[nodiscard]] Shard &ShardFor(std::uint64_t hash) {
+    return shards_[hash % kShardCount];
+  }
+  [[nodiscard]] const Shard &ShardFor(std::uint64_t hash) const {
+    return shards_[hash % kShardCount];
+  }
+
+  std::array<Shard, kShardCount> shards_;
+};
+
+} // namespace Easy2Read
@@ -1,10 +1,126 @@
 #include "TextSanitizer.h"
 #include "PCH.h"
+#include "StringPool.h"
+#include "Utils/Hash.h"
 #include <array>
 #include <unordered_map>
 
 namespace Easy2Read {
 
+namespace {
+// Output sinks for SanitizeWith. Each provides Append() and size(), where
+// size() is the logical output length produced so far.
+
+// Appends to a std::string
+struct StringSink {
+  std::string &out;
+  void Append(const char *data, size_t size) { out.append(data, size); }
+  [[nodiscard]] size_t size() const { return out.size(); }
+};
+
+// Writes into a caller-provided buffer; bytes past the capacity are counted
+// but not written, so size() reports the required length
+struct BufferSink {
+  char *out;
+  size_t capacity;
+  size_t written = 0;
+
+  void Append(const char *data, size_t size) {
+    if (out && written < capacity) {
+      std::memcpy(out + written, data, std::min(size, capacity - written));
+    }
+    written += size;
+  }
+  [[nodiscard]] size_t size() const { return written; }
+};
+
+// Rewrites the input buffer itself. Runs copied from the input tell the sink
+// how far the sanitizer has read; replacement bytes are held back until the
+// next run (or Finish) proves they fit without clobbering unread input. If
+// they don't, everything produced so far moves to the overflow string.
+struct InPlaceSink {
+  static constexpr size_t kPendingCapacity = 32;
+
+  char *data;
+  size_t inputSize;
+  size_t capacity;
+  std::string &overflow;
+
+  size_t written = 0;
+  char pending[kPendingCapacity];
+  size_t pendingSize = 0;
+  bool overflowed = false;
+  bool changed = false;
+
+  void Append(const char *src, size_t size) {
+    if (overflowed) {
+      overflow.append(src, size);
+      return;
+    }
+
+    const bool fromInput = src >= data && src <= data + inputSize;
+    if (!fromInput) {
+      changed = true;
+      if (pendingSize + size > kPendingCapacity) {
+        SpillToOverflow();
+        overflow.append(src, size);
+        return;
+      }
+      std::memcpy(pending + pendingSize, src, size);
+      pendingSize += size;
+      return;
+    }
+
+    // src is the sanitizer's read position; nothing before it is needed again
+    const auto readPos = static_cast<size_t>(src - data);
+    if (!FlushPending(readPos)) {
+      SpillToOverflow();
+      overflow.append(src, size);
+      return;
+    }
+    if (readPos != written) {
+      changed = true;
+      std::memmove(data + written, src, size);
+    }
+    written += size;
+  }
+
+  // Place held-back replacement bytes; all input has been read by now
+  void Finish() {
+    if (!overflowed && !FlushPending(capacity)) {
+      SpillToOverflow();
+    }
+    if (!overflowed) {
+      data[written] = '\0';
+      changed = changed || written != inputSize;
+    }
+  }
+
+  [[nodiscard]] size_t size() const {
+    return overflowed ? overflow.size() : written + pendingSize;
+  }
+
+private:
+  bool FlushPending(size_t limit) {
+    if (written + pendingSize > limit) {
+      return false;
+    }
+    std::memcpy(data + written, pending, pendingSize);
+    written += pendingSize;
+    pendingSize = 0;
+    return true;
+  }
+
+  void SpillToOverflow() {
+    overflow.reserve(inputSize + inputSize / 8 + pendingSize);
+    overflow.assign(data, written);
+    overflow.append(pending, pendingSize);
+    pendingSize = 0;
+    overflowed = true;
+  }
+};
+} // namespace
+
 // AnyASCII-style transliteration table for common unsupported characters
 static const std::unordered_map<uint32_t, std::string_view>
     kTransliterationTable = {
@@ -145,7 +261,48 @@ TextSanitizer *TextSanitizer::GetSingleton() {
   return &singleton;
 }
 
-TextSanitizer::TextSanitizer() { InitializeSupportedChars(); }
+TextSanitizer::TextSanitizer() {
+  InitializeSupportedChars();
+  BuildSingleByteTable();
+}
+
+void TextSanitizer::SetLatin1ToUTF8(bool convert) {
+  if (latin1ToUtf8_ != convert) {
+    latin1ToUtf8_ = convert;
+    BuildSingleByteTable();
+  }
+}
+
+void TextSanitizer::BuildSingleByteTable() {
+  singleByteTable_.Reset();
+
+  for (uint32_t b = 0x80; b <= 0xFF; ++b) {
+    const auto byte = static_cast<std::uint8_t>(b);
+
+    // 0x80-0x9F: Windows-1252 punctuation
+    if (b <= 0x9F) {
+      singleByteTable_.Set(byte, kCP1252Table[b - 0x80]);
+      continue;
+    }
+
+    // 0xA0-0xFF: Latin-1, identical to U+00A0-U+00FF
+    const char utf8[2] = {static_cast<char>(0xC0 | (b >> 6)),
+                          static_cast<char>(0x80 | (b & 0x3F))};
+    if (IsSupported(b)) {
+      if (latin1ToUtf8_) {
+        singleByteTable_.Set(byte, std::string_view(utf8, 2));
+      }
+      continue;
+    }
+
+    auto it = kTransliterationTable.find(b);
+    if (it != kTransliterationTable.end()) {
+      singleByteTable_.Set(byte, it->second);
+    } else if (latin1ToUtf8_) {
+      singleByteTable_.Set(byte, std::string_view(utf8, 2));
+    }
+  }
+}
 
 void TextSanitizer::InitializeSupportedChars() {
   // Valid characters from Tofu-Detective (Skyrim's validNameChars):
@@ -244,6 +401,16 @@ bool TextSanitizer::NeedsSanitization(std::string_view input) const {
     return false;
   }
 
+  auto &counters = LocalCounters();
+  counters.scanned.fetch_add(1, std::memory_order_relaxed);
+  const bool flagged = ContainsUnsupported(input);
+  if (flagged) {
+    counters.flagged.fetch_add(1, std::memory_order_relaxed);
+  }
+  return flagged;
+}
+
+bool TextSanitizer::ContainsUnsupported(std::string_view input) const {
   size_t i = 0;
   while (i < input.size()) {
     uint32_t codepoint = 0;
@@ -288,22 +455,95 @@ bool TextSanitizer::NeedsSanitization(std::string_view input) const {
   return false;
 }
 
-std::string TextSanitizer::Sanitize(std::string_view input) const {
-  if (!enabled_ || mode_ == SanitizationMode::Off) {
-    return std::string(input);
+size_t TextSanitizer::FindUnsupported(std::string_view input,
+                                      std::vector<uint32_t> &codepoints,
+                                      size_t maxCodepoints) const {
+  size_t firstOffset = std::string_view::npos;
+
+  auto report = [&](uint32_t codepoint, size_t offset) {
+    if (firstOffset == std::string_view::npos) {
+      firstOffset = offset;
+    }
+    if (codepoints.size() < maxCodepoints &&
+        std::find(codepoints.begin(), codepoints.end(), codepoint) ==
+            codepoints.end()) {
+      codepoints.push_back(codepoint);
+    }
+  };
+
+  size_t i = 0;
+  while (i < input.size()) {
+    uint32_t codepoint = 0;
+    size_t charLen = 1;
+    unsigned char c = static_cast<unsigned char>(input[i]);
+
+    if (c < 0x80) {
+      codepoint = c;
+    } else if ((c & 0xE0) == 0xC0 && i + 1 < input.size()) {
+      codepoint = (c & 0x1F) << 6;
+      codepoint |= (static_cast<unsigned char>(input[i + 1]) & 0x3F);
+      charLen = 2;
+    } else if ((c & 0xF0) == 0xE0 && i + 2 < input.size()) {
+      codepoint = (c & 0x0F) << 12;
+      codepoint |= (static_cast<unsigned char>(input[i + 1]) & 0x3F) << 6;
+      codepoint |= (static_cast<unsigned char>(input[i + 2]) & 0x3F);
+      charLen = 3;
+    } else if ((c & 0xF8) == 0xF0 && i + 3 < input.size()) {
+      codepoint = (c & 0x07) << 18;
+      codepoint |= (static_cast<unsigned char>(input[i + 1]) & 0x3F) << 12;
+      codepoint |= (static_cast<unsigned char>(input[i + 2]) & 0x3F) << 6;
+      codepoint |= (static_cast<unsigned char>(input[i + 3]) & 0x3F);
+      charLen = 4;
+    } else {
+      // Invalid UTF-8 (CP1252 / Latin-1 byte)
+      report(c, i);
+      i += 1;
+      continue;
+    }
+
+    if (!IsSupported(codepoint)) {
+      report(codepoint, i);
+    }
+    i += charLen;
   }
 
-  // Fast path: if no sanitization needed, return input as-is
-  if (!NeedsSanitization(input)) {
-    return std::string(input);
+  return firstOffset;
+}
+
+std::string TextSanitizer::Sanitize(std::string_view input) const {
+  std::string result;
+  SanitizeTo(input, result);
+  return result;
+}
+
+std::string_view TextSanitizer::SanitizeInterned(std::string_view input) const {
+  thread_local std::string scratch;
+  SanitizeTo(input, scratch);
+  return StringPool::GetSingleton()->Intern(scratch);
+}
+
+template <class Sink>
+void TextSanitizer::SanitizeWith(std::string_view input, Sink &sink) const {
+  auto &counters = LocalCounters();
+  counters.sanitized.fetch_add(1, std::memory_order_relaxed);
+  counters.bytesIn.fetch_add(input.size(), std::memory_order_relaxed);
+
+  // Legacy single-byte strings (CP1252/Latin-1) go through the table-driven
+  // kernel, which copies plain runs directly and only looks up special bytes
+  if (mode_ == SanitizationMode::AnyASCII && IsSingleByteEncoded(input)) {
+    TranslateSingleByte(input, singleByteTable_, sink);
+    counters.bytesOut.fetch_add(sink.size(), std::memory_order_relaxed);
+    if (debugMode_ || logReplacements_) {
+      SKSE::log::info("TextSanitizer: Translated single-byte string ({} -> {} "
+                      "bytes)",
+                      input.size(), sink.size());
+    }
+    return;
   }
 
   const size_t maxOutputSize = static_cast<size_t>(
       static_cast<float>(input.size()) * maxExpansionRatio_);
 
-  std::string result;
-  result.reserve(input.size());
-
   // Track if we're inside angle brackets (e.g., <Alias=Player>)
   // Content inside these should be preserved as-is, but only if both < and >
   // exist
@@ -327,19 +567,19 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
       if (hasMatchingBrackets) {
         if (c == '<') {
           insideAngleBrackets = true;
-          result += static_cast<char>(c);
+          sink.Append(input.data() + i, 1);
           i += 1;
           continue;
         } else if (c == '>') {
           insideAngleBrackets = false;
-          result += static_cast<char>(c);
+          sink.Append(input.data() + i, 1);
           i += 1;
           continue;
         }
 
         // If inside angle brackets, just copy the byte and continue
         if (insideAngleBrackets) {
-          result += static_cast<char>(c);
+          sink.Append(input.data() + i, 1);
           i += 1;
           continue;
         }
@@ -350,7 +590,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
       charLen = 2;
       // If inside angle brackets, copy and skip sanitization
       if (insideAngleBrackets) {
-        result.append(input.substr(i, charLen));
+        sink.Append(input.data() + i, charLen);
         i += charLen;
         continue;
       }
@@ -361,7 +601,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
       charLen = 3;
       // If inside angle brackets, copy and skip sanitization
       if (insideAngleBrackets) {
-        result.append(input.substr(i, charLen));
+        sink.Append(input.data() + i, charLen);
         i += charLen;
         continue;
       }
@@ -373,7 +613,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
       charLen = 4;
       // If inside angle brackets, copy and skip sanitization
       if (insideAngleBrackets) {
-        result.append(input.substr(i, charLen));
+        sink.Append(input.data() + i, charLen);
         i += charLen;
         continue;
       }
@@ -389,25 +629,25 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
         }
 
         if (mode_ == SanitizationMode::AnyASCII && !replacement.empty()) {
-          result.append(replacement);
+          sink.Append(replacement.data(), replacement.size());
         } else if (mode_ == SanitizationMode::DetectOnly) {
-          result += static_cast<char>(c);
+          sink.Append(input.data() + i, 1);
         }
-      } else if (c >= 0xA0 && c <= 0xFF) {
+      } else if (c >= 0xA0) {
         // Latin-1 Supplement (0xA0-0xFF) - these map directly to Unicode
         // U+00A0-U+00FF Check if they're in our supported set
         if (IsSupported(c)) {
-          result += static_cast<char>(c);
+          sink.Append(input.data() + i, 1);
         } else {
           // Try to transliterate
           auto it = kTransliterationTable.find(c);
           if (it != kTransliterationTable.end()) {
             if (mode_ == SanitizationMode::AnyASCII) {
-              result.append(it->second);
+              sink.Append(it->second.data(), it->second.size());
             }
           } else if (mode_ == SanitizationMode::AnyASCII) {
             // No mapping found - pass through unchanged
-            result += static_cast<char>(c);
+            sink.Append(input.data() + i, 1);
           }
         }
       } else {
@@ -415,7 +655,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
         SKSE::log::debug("TextSanitizer: Unknown byte 0x{:02X} at position {}, "
                          "passing through",
                          c, i);
-        result += static_cast<char>(c);
+        sink.Append(input.data() + i, 1);
       }
       i += 1;
       continue;
@@ -423,7 +663,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
 
     if (IsSupported(codepoint)) {
       // Character is supported, copy original bytes
-      result.append(input.substr(i, charLen));
+      sink.Append(input.data() + i, charLen);
     } else {
       // Character not supported, needs replacement
       if (mode_ == SanitizationMode::AnyASCII) {
@@ -431,7 +671,7 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
 
         // If no mapping, pass through unchanged
         if (replacement.empty()) {
-          result.append(input.substr(i, charLen));
+          sink.Append(input.data() + i, charLen);
           SKSE::log::debug(
               "TextSanitizer: No mapping for U+{:04X}, passing through",
               codepoint);
@@ -439,13 +679,13 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
           SKSE::log::debug("TextSanitizer: Replacing U+{:04X} -> '{}'",
                            codepoint, replacement);
           // Check expansion limit
-          if (result.size() + replacement.size() <= maxOutputSize) {
-            result.append(replacement);
+          if (sink.size() + replacement.size() <= maxOutputSize) {
+            sink.Append(replacement.data(), replacement.size());
           }
         }
       } else if (mode_ == SanitizationMode::DetectOnly) {
         // DetectOnly: log but keep original
-        result.append(input.substr(i, charLen));
+        sink.Append(input.data() + i, charLen);
         if (debugMode_ || logReplacements_) {
           SKSE::log::info("TextSanitizer: Detected unsupported U+{:04X}",
                           codepoint);
@@ -456,7 +696,87 @@ std::string TextSanitizer::Sanitize(std::string_view input) const {
     i += charLen;
   }
 
+  counters.bytesOut.fetch_add(sink.size(), std::memory_order_relaxed);
+}
+
+void TextSanitizer::SanitizeTo(std::string_view input,
+                               std::string &result) const {
+  // Fast path: if no sanitization needed, copy input as-is
+  if (!NeedsSanitization(input)) {
+    result.assign(input);
+    return;
+  }
+
+  result.clear();
+  result.reserve(input.size() + input.size() / 8);
+  StringSink sink{result};
+  SanitizeWith(input, sink);
+}
+
+size_t TextSanitizer::SanitizeInto(std::string_view input, char *output,
+                                   size_t capacity) const {
+  if (!NeedsSanitization(input)) {
+    if (output && input.size() <= capacity) {
+      std::memcpy(output, input.data(), input.size());
+    }
+    return input.size();
+  }
+
+  BufferSink sink{output, capacity};
+  SanitizeWith(input, sink);
+  return sink.size();
+}
+
+TextSanitizer::InPlaceResult
+TextSanitizer::SanitizeInPlace(char *data, size_t size, size_t capacity,
+                               std::string &overflow) const {
+  overflow.clear();
+  InPlaceSink sink{data, size, capacity, overflow, 0, {}, 0, false, false};
+  SanitizeWith(std::string_view(data, size), sink);
+  sink.Finish();
+
+  InPlaceResult result;
+  result.length = sink.size();
+  result.inPlace = !sink.overflowed;
+  result.changed = sink.changed;
   return result;
 }
 
+std::uint64_t TextSanitizer::GetConfigFingerprint() const {
+  std::uint64_t fingerprint = HashCombine(0, kTableVersion);
+  fingerprint = HashCombine(fingerprint, static_cast<std::uint64_t>(mode_));
+  fingerprint = HashCombine(fingerprint, latin1ToUtf8_ ? 1 : 0);
+  fingerprint = HashCombine(
+      fingerprint, static_cast<std::uint64_t>(maxExpansionRatio_ * 1000.0f));
+  return fingerprint;
+}
+
+TextSanitizer::Counters &TextSanitizer::LocalCounters() const {
+  // Threads take stripes round-robin on first use
+  static std::atomic<std::size_t> nextStripe{0};
+  thread_local const std::size_t stripe =
+      nextStripe.fetch_add(1, std::memory_order_relaxed) % kCounterStripes;
+  return counters_[stripe];
+}
+
+TextSanitizer::Stats TextSanitizer::GetStats() const {
+  Stats stats;
+  for (const auto &counters : counters_) {
+    stats.scanned += counters.scanned.load(std::memory_order_relaxed);
+    stats.flagged += counters.flagged.load(std::memory_order_relaxed);
+    stats.sanitized += counters.sanitized.load(std::memory_order_relaxed);
+    stats.bytesIn += counters.bytesIn.load(std::memory_order_relaxed);
+    stats.bytesOut += counters.bytesOut.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void TextSanitizer::LogStats() const {
+  const auto stats = GetStats();
+  SKSE::log::info("TextSanitizer: {} strings scanned, {} flagged, {} "
+                  "sanitized ({} -> {} bytes)",
+                  stats.scanned, stats.flagged, stats.sanitized, stats.bytesIn,
+                  stats.bytesOut);
+}
+
 } // namespace Easy2Read
@@ -1,8 +1,14 @@
 #pragma once
 
+#include "SingleByteKernel.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <vector>
 
 namespace Easy2Read {
 
@@ -27,6 +33,41 @@ struct HookSettings {
   bool enableNpcName = true;
 };
 
+/**
+ * Identifies the record-level text hook a string came from.
+ */
+enum class TextHook : std::uint8_t {
+  Description,      // DESC/CNAM
+  DialogueResponse, // INFO NAM1
+  DialogueMenu,     // DIAL FULL, INFO RNAM
+  Quest,            // QUST CNAM
+  MapMarker,        // REFR FULL
+  NpcName,          // NPC FULL
+  kTotal
+};
+
+/**
+ * Short record/subrecord label for a hook (e.g. "INFO NAM1").
+ */
+[[nodiscard]] constexpr std::string_view GetTextHookLabel(TextHook hook) {
+  switch (hook) {
+  case TextHook::Description:
+    return "DESC";
+  case TextHook::DialogueResponse:
+    return "NAM1";
+  case TextHook::DialogueMenu:
+    return "DIAL FULL";
+  case TextHook::Quest:
+    return "QUST CNAM";
+  case TextHook::MapMarker:
+    return "REFR FULL";
+  case TextHook::NpcName:
+    return "NPC FULL";
+  default:
+    return "UNKNOWN";
+  }
+}
+
 /**
  * Runtime text sanitizer that detects and replaces unsupported Unicode
  * characters. Uses the Tofu-Detective valid character set for detection and
@@ -43,6 +84,55 @@ public:
    */
   [[nodiscard]] std::string Sanitize(std::string_view input) const;
 
+  /**
+   * Sanitize into a caller-owned string, reusing its capacity.
+   * @param input The input string to sanitize
+   * @param output Receives the sanitized text (previous contents replaced)
+   */
+  void SanitizeTo(std::string_view input, std::string &output) const;
+
+  /**
+   * Sanitize and intern the result in the global StringPool.
+   * Uses a per-thread scratch buffer, so no heap allocation happens once the
+   * result is already pooled.
+   * @param input The input string to sanitize
+   * @return Stable view of the pooled sanitized text
+   */
+  [[nodiscard]] std::string_view SanitizeInterned(std::string_view input) const;
+
+  /**
+   * Sanitize into a caller-provided buffer without allocating.
+   * Output is not NUL-terminated. If the buffer is too small, it holds a
+   * truncated prefix and the return value tells the size needed.
+   * @param input The input string to sanitize
+   * @param output Destination buffer (may be nullptr to only measure)
+   * @param capacity Size of the destination buffer in bytes
+   * @return Length of the full sanitized output in bytes
+   */
+  size_t SanitizeInto(std::string_view input, char *output,
+                      size_t capacity) const;
+
+  struct InPlaceResult {
+    size_t length = 0;    // Output length in bytes
+    bool inPlace = true;  // false: output is in the overflow string
+    bool changed = false; // Output differs from the input
+  };
+
+  /**
+   * Sanitize a mutable buffer in place in one streaming pass.
+   * Output is written over the input while it never overtakes the bytes still
+   * to be read and fits in the buffer; otherwise the complete output is built
+   * in `overflow` instead. Call after NeedsSanitization() returned true.
+   * @param data Buffer holding the input, with room for capacity + 1 bytes
+   * @param size Input length in bytes
+   * @param capacity Usable buffer size, excluding the NUL terminator
+   * @param overflow Receives the output if it did not fit in place
+   * @return Output length and where the output ended up; in-place output is
+   *         NUL-terminated
+   */
+  InPlaceResult SanitizeInPlace(char *data, size_t size, size_t capacity,
+                                std::string &overflow) const;
+
   /**
    * Fast check if a string contains any unsupported characters.
    * @param input The string to check
@@ -50,6 +140,18 @@ public:
    */
   [[nodiscard]] bool NeedsSanitization(std::string_view input) const;
 
+  /**
+   * Collect the unsupported codepoints in a string (for reporting).
+   * Invalid single bytes are reported as their byte value.
+   * @param input The string to scan
+   * @param codepoints Receives distinct offending codepoints, in order found
+   * @param maxCodepoints Stop collecting after this many distinct codepoints
+   * @return Byte offset of the first offending character, or npos if none
+   */
+  size_t FindUnsupported(std::string_view input,
+                         std::vector<uint32_t> &codepoints,
+                         size_t maxCodepoints = 16) const;
+
   /**
    * Check if a specific Unicode codepoint is supported by Skyrim's fonts.
    * @param codepoint The Unicode codepoint to check
@@ -64,6 +166,26 @@ public:
    */
   [[nodiscard]] std::string_view GetReplacement(uint32_t codepoint) const;
 
+  // Usage statistics shared by the hooks, BookUtils and the plugin API
+  struct Stats {
+    std::uint64_t scanned = 0;   // NeedsSanitization calls
+    std::uint64_t flagged = 0;   // Strings found to need sanitization
+    std::uint64_t sanitized = 0; // Strings run through replacement
+    std::uint64_t bytesIn = 0;   // Input bytes of sanitized strings
+    std::uint64_t bytesOut = 0;  // Output bytes of sanitized strings
+  };
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+  // Bump whenever the supported set or replacement tables change output
+  static constexpr std::uint32_t kTableVersion = 1;
+
+  /**
+   * Identity of everything that determines sanitizer output: table version,
+   * mode and options. Results cached under a different fingerprint are stale.
+   */
+  [[nodiscard]] std::uint64_t GetConfigFingerprint() const;
+
   // Configuration
   void SetEnabled(bool enabled) { enabled_ = enabled; }
   [[nodiscard]] bool IsEnabled() const { return enabled_; }
@@ -74,6 +196,10 @@ public:
   void SetLogReplacements(bool log) { logReplacements_ = log; }
   [[nodiscard]] bool GetLogReplacements() const { return logReplacements_; }
 
+  // Emit supported Latin-1 bytes of single-byte strings as UTF-8
+  void SetLatin1ToUTF8(bool convert);
+  [[nodiscard]] bool GetLatin1ToUTF8() const { return latin1ToUtf8_; }
+
   void SetMaxExpansionRatio(float ratio) { maxExpansionRatio_ = ratio; }
   [[nodiscard]] float GetMaxExpansionRatio() const {
     return maxExpansionRatio_;
@@ -97,16 +223,43 @@ private:
 
   void InitializeSupportedChars();
   void InitializeTransliterationTable();
+  void BuildSingleByteTable();
+
+  // Scan for unsupported characters, ignoring mode and statistics
+  [[nodiscard]] bool ContainsUnsupported(std::string_view input) const;
+
+  // Core replacement loop shared by all output flavours (see sinks in .cpp)
+  template <class Sink>
+  void SanitizeWith(std::string_view input, Sink &sink) const;
 
   // Set of codepoints supported by Skyrim's fonts
   std::unordered_set<uint32_t> supportedChars_;
 
+  // Byte translation for CP1252/Latin-1 strings (AnyASCII mode)
+  SingleByteTable singleByteTable_;
+
+  // Usage counters striped by thread: each hook thread bumps its own cache
+  // line, and GetStats sums the stripes
+  struct alignas(64) Counters {
+    std::atomic<std::uint64_t> scanned{0};
+    std::atomic<std::uint64_t> flagged{0};
+    std::atomic<std::uint64_t> sanitized{0};
+    std::atomic<std::uint64_t> bytesIn{0};
+    std::atomic<std::uint64_t> bytesOut{0};
+  };
+  static constexpr std::size_t kCounterStripes = 16;
+  mutable std::array<Counters, kCounterStripes> counters_;
+
+  // Stripe of the calling thread
+  [[nodiscard]] Counters &LocalCounters() const;
+
   // Configuration
   bool enabled_ = true;
   SanitizationMode mode_ = SanitizationMode::AnyASCII;
   bool logReplacements_ = false;
   float maxExpansionRatio_ = 3.0f;
   bool debugMode_ = false;
+  bool latin1ToUtf8_ = false;
   HookSettings hooks_;
 };
 
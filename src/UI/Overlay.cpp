@@ -1,6 +1,8 @@
 #include "Overlay.h"
 #include "Config/Settings.h"
 #include "PCH.h"
+#include "Utils/BookDocument.h"
+#include <cstdio>
 #include <imgui.h>
 
 namespace Easy2Read {
@@ -230,9 +232,12 @@ void Overlay::RenderWindow() {
     ImGui::PushFont(customFont);
   }
 
+  // Hold the document for the whole frame, even if it is replaced meanwhile
+  const auto content = document.load();
+
   if (ImGui::Begin("###Easy2ReadOverlay", nullptr, flags)) {
     // Title section (conditionally rendered)
-    if (settings->showTitle) {
+    if (settings->showTitle && content) {
       ImVec4 titleColor(settings->titleColorR / 255.0f,
                         settings->titleColorG / 255.0f,
                         settings->titleColorB / 255.0f, 1.0f);
@@ -242,7 +247,10 @@ void Overlay::RenderWindow() {
       float originalScale = ImGui::GetFont()->Scale;
       ImGui::GetFont()->Scale *= settings->titleScale;
       ImGui::PushFont(ImGui::GetFont());
-      ImGui::TextWrapped("%s", bookTitle.c_str());
+      ImGui::PushTextWrapPos(0.0f);
+      ImGui::TextUnformatted(content->title.data(),
+                             content->title.data() + content->title.size());
+      ImGui::PopTextWrapPos();
       ImGui::PopFont();
       ImGui::GetFont()->Scale = originalScale;
       ImGui::PopStyleColor();
@@ -260,8 +268,19 @@ void Overlay::RenderWindow() {
                      settings->bodyColorB / 255.0f, 1.0f);
     ImGui::PushStyleColor(ImGuiCol_Text, bodyColor);
 
+    // In page mode only the current page is laid out; the last line of the
+    // window is kept for the page counter
+    std::size_t page = 0;
+    std::size_t pageCount = 1;
+    if (content && settings->pageMode) {
+      page = UpdatePage(content);
+      pageCount = content->GetPageCount();
+    }
+    const float footerHeight =
+        pageCount > 1 ? ImGui::GetFrameHeightWithSpacing() : 0.0f;
+
     // Scrollable text region
-    ImGui::BeginChild("BookTextScroll", ImVec2(0, 0), false,
+    ImGui::BeginChild("BookTextScroll", ImVec2(0, -footerHeight), false,
                       ImGuiWindowFlags_None);
 
     // Reset scroll to top when overlay was just opened
@@ -279,11 +298,31 @@ void Overlay::RenderWindow() {
       pendingScrollDelta = 0.0f;
     }
 
-    // Render book text with word wrapping
-    ImGui::TextWrapped("%s", bookText.c_str());
+    // Render book text with word wrapping; the book may still be processing
+    if (content && settings->pageMode) {
+      const auto [begin, end] = content->GetPageRange(page);
+      RenderBody(*content, begin, end);
+    } else if (content) {
+      RenderBody(*content, 0, static_cast<std::uint32_t>(content->text.size()));
+    } else {
+      ImGui::TextDisabled("Loading...");
+    }
 
     ImGui::EndChild();
 
+    // Page counter, centered under the text
+    if (pageCount > 1) {
+      char counter[32];
+      const auto length =
+          std::snprintf(counter, sizeof(counter), "%zu / %zu", page + 1,
+                        pageCount);
+      const float counterWidth =
+          ImGui::CalcTextSize(counter, counter + length).x;
+      ImGui::SetCursorPosX(
+          (ImGui::GetWindowWidth() - counterWidth) / 2.0f);
+      ImGui::TextUnformatted(counter, counter + length);
+    }
+
     ImGui::PopStyleColor(); // Body text color
   }
   ImGui::End();
@@ -297,17 +336,88 @@ void Overlay::RenderWindow() {
   ImGui::PopStyleColor(9); // All colors pushed above
 }
 
-void Overlay::SetContent(const std::string &title, const std::string &text) {
-  bookTitle = title;
-  bookText = text;
-  SKSE::log::debug("Overlay content set: {}", title);
+void Overlay::RenderBody(const BookDocument &content, std::uint32_t begin,
+                         std::uint32_t end) {
+  // Line breaks left at the end of a page would only add blank space
+  while (end > begin && content.text[end - 1] == '\n') {
+    --end;
+  }
+
+  // One wrapped text item per paragraph, straight from the document's text;
+  // nothing is copied or formatted per frame
+  ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing,
+                      ImVec2(ImGui::GetStyle().ItemSpacing.x, 0.0f));
+  ImGui::PushTextWrapPos(0.0f);
+
+  // First paragraph that reaches into the range
+  const auto &paragraphs = content.paragraphs;
+  auto it = std::partition_point(
+      paragraphs.begin(), paragraphs.end(), [begin](const auto &paragraph) {
+        return paragraph.offset + paragraph.length < begin;
+      });
+
+  const float width = ImGui::GetContentRegionAvail().x;
+  for (; it != paragraphs.end() && it->offset < end; ++it) {
+    // A page may start or end inside a paragraph
+    const auto first = (std::max)(it->offset, begin);
+    const auto last = (std::min)(it->offset + it->length, end);
+    const char *text = content.text.data() + first;
+    const char *textEnd = content.text.data() + last;
+    if (text == textEnd) {
+      ImGui::NewLine(); // Blank line between paragraphs
+      continue;
+    }
+
+    // Centered and right-aligned paragraphs are offset when they fit on one
+    // line; longer ones wrap left-aligned
+    const auto align = content.GetStyle(it->style).align;
+    if (align == BookAlign::Center || align == BookAlign::Right) {
+      const float textWidth = ImGui::CalcTextSize(text, textEnd).x;
+      if (textWidth < width) {
+        const float offset = align == BookAlign::Center
+                                 ? (width - textWidth) / 2.0f
+                                 : width - textWidth;
+        ImGui::SetCursorPosX(ImGui::GetCursorPosX() + offset);
+      }
+    }
+    ImGui::TextUnformatted(text, textEnd);
+  }
+
+  ImGui::PopTextWrapPos();
+  ImGui::PopStyleVar();
+}
+
+std::size_t
+Overlay::UpdatePage(const std::shared_ptr<const BookDocument> &content) {
+  // A new book starts at its first page
+  if (pagedDocument != content) {
+    pagedDocument = content;
+    currentPage = 0;
+    pendingPageTurns.store(0);
+  }
+
+  const int turns = pendingPageTurns.exchange(0);
+  if (turns != 0) {
+    const auto last = static_cast<long long>(content->GetPageCount()) - 1;
+    const auto target = std::clamp(
+        static_cast<long long>(currentPage) + turns, 0LL, last);
+    if (static_cast<std::size_t>(target) != currentPage) {
+      currentPage = static_cast<std::size_t>(target);
+      resetScrollOnNextFrame = true;
+    }
+  }
+  return currentPage;
 }
 
-void Overlay::ClearContent() {
-  bookTitle.clear();
-  bookText.clear();
+void Overlay::SetContent(std::shared_ptr<const BookDocument> content) {
+  if (content) {
+    SKSE::log::debug("Overlay content set: {}", content->title);
+  }
+  document.store(std::move(content));
 }
 
+void Overlay::ClearContent() { document.store(nullptr); }
+
 void Overlay::Show() {
   if (!visible) {
     visible = true;
@@ -333,4 +443,6 @@ void Overlay::Toggle() {
 
 void Overlay::AddScrollInput(float delta) { pendingScrollDelta += delta; }
 
+void Overlay::TurnPages(int delta) { pendingPageTurns.fetch_add(delta); }
+
 } // namespace Easy2Read
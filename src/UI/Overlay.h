@@ -1,10 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <imgui.h>
-#include <string>
+#include <memory>
 
 namespace Easy2Read {
 
+struct BookDocument;
+
 class Overlay {
 public:
   [[nodiscard]] static Overlay *GetSingleton();
@@ -15,8 +19,8 @@ public:
   // Main render function - called every frame by D3D11Hook
   void Render();
 
-  // Set content to display
-  void SetContent(const std::string &title, const std::string &text);
+  // Set content to display. The document is shared, not copied.
+  void SetContent(std::shared_ptr<const BookDocument> document);
   void ClearContent();
 
   // Visibility control
@@ -28,6 +32,9 @@ public:
   // Scroll input - accumulates scroll delta from InputHandler
   void AddScrollInput(float delta);
 
+  // Page input (page mode) - accumulates page turns from InputHandler
+  void TurnPages(int delta);
+
 private:
   Overlay() = default;
   Overlay(const Overlay &) = delete;
@@ -38,13 +45,18 @@ private:
   Overlay &operator=(Overlay &&) = delete;
 
   void RenderWindow();
+  void RenderBody(const BookDocument &content, std::uint32_t begin,
+                  std::uint32_t end);
+
+  // Page to show this frame (page mode); applies pending turns
+  std::size_t UpdatePage(const std::shared_ptr<const BookDocument> &content);
   void LoadFont();
 
   bool visible = false;
   bool fontLoaded = false;
 
-  std::string bookTitle;
-  std::string bookText;
+  // Set from the input thread, read once per frame by the render thread
+  std::atomic<std::shared_ptr<const BookDocument>> document;
 
   // Accumulated scroll input from InputHandler
   float pendingScrollDelta = 0.0f;
@@ -52,6 +64,12 @@ private:
   // Reset scroll position on next frame
   bool resetScrollOnNextFrame = false;
 
+  // Page mode: page turns from InputHandler, and the page shown (render
+  // thread only; reset when the document changes)
+  std::atomic<int> pendingPageTurns{0};
+  std::size_t currentPage = 0;
+  std::shared_ptr<const BookDocument> pagedDocument;
+
   // ImGui font pointer
   ImFont *customFont = nullptr;
 };
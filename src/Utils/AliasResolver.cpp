@@ -30,8 +30,8 @@ std::string AliasResolver::ResolveAliases(const std::string &text,
     return text;
   }
 
-  SKSE::log::info("AliasResolver: Found quest '{}' for book '{}'",
-                  owningQuest->GetName(), book->GetName());
+  SKSE::log::debug("AliasResolver: Found quest '{}' for book '{}'",
+                   owningQuest->GetName(), book->GetName());
 
   std::string result = text;
 
@@ -57,8 +57,8 @@ std::string AliasResolver::ResolveAliases(const std::string &text,
     if (alias) {
       std::string resolvedName = ResolveAliasName(alias);
       if (!resolvedName.empty()) {
-        SKSE::log::info("AliasResolver: Resolved <Alias={}> -> '{}'", aliasName,
-                        resolvedName);
+        SKSE::log::debug("AliasResolver: Resolved <Alias={}> -> '{}'",
+                         aliasName, resolvedName);
         processedResult.append(resolvedName);
       } else {
         // Couldn't resolve, keep original tag
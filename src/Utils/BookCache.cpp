@@ -0,0 +1,105 @@
+#include "BookCache.h"
+#include "BookDocument.h"
+#include "Hash.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+BookCache *BookCache::GetSingleton() {
+  static BookCache singleton;
+  return &singleton;
+}
+
+std::size_t BookCache::KeyHash::operator()(const Key &key) const noexcept {
+  return static_cast<std::size_t>(HashCombine(key.fingerprint, key.formID));
+}
+
+void BookCache::SetBudget(std::size_t bytes) {
+  std::lock_guard lock(lock_);
+  budget_ = bytes;
+  EvictLocked();
+}
+
+std::shared_ptr<const BookDocument> BookCache::Find(const Key &key) {
+  std::lock_guard lock(lock_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->document;
+}
+
+bool BookCache::Contains(const Key &key) const {
+  std::lock_guard lock(lock_);
+  return index_.contains(key);
+}
+
+void BookCache::Insert(const Key &key,
+                       std::shared_ptr<const BookDocument> document) {
+  if (!document) {
+    return;
+  }
+  const std::size_t bytes = document->GetMemoryUsage();
+
+  std::lock_guard lock(lock_);
+  if (auto it = index_.find(key); it != index_.end()) {
+    bytes_ -= it->second->bytes;
+    lru_.erase(it->second);
+    index_.erase(it);
+  }
+  if (bytes > budget_) {
+    return;
+  }
+
+  lru_.push_front(Entry{key, std::move(document), bytes});
+  index_.emplace(key, lru_.begin());
+  bytes_ += bytes;
+  EvictLocked();
+}
+
+void BookCache::Clear() {
+  std::lock_guard lock(lock_);
+  lru_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+void BookCache::EvictLocked() {
+  while (bytes_ > budget_ && !lru_.empty()) {
+    const auto &victim = lru_.back();
+    bytes_ -= victim.bytes;
+    index_.erase(victim.key);
+    lru_.pop_back();
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+BookCache::Stats BookCache::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  std::lock_guard lock(lock_);
+  stats.entries = lru_.size();
+  stats.bytes = bytes_;
+  stats.budget = budget_;
+  return stats;
+}
+
+void BookCache::LogStats() const {
+  const auto stats = GetStats();
+  const auto lookups = stats.hits + stats.misses;
+  const double hitRatio =
+      lookups > 0 ? 100.0 * static_cast<double>(stats.hits) /
+                        static_cast<double>(lookups)
+                  : 0.0;
+  SKSE::log::info("BookCache: {} books, {} / {} KB, {} hits / {} lookups "
+                  "({:.1f}%), {} evicted",
+                  stats.entries, stats.bytes / 1024, stats.budget / 1024,
+                  stats.hits, lookups, hitRatio, stats.evictions);
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Easy2Read {
+
+struct BookDocument;
+
+/**
+ * Bounded LRU cache of processed books (BookDocument), so reopening a book or
+ * toggling the overlay doesn't run alias resolution, markup cleanup and
+ * sanitization again.
+ *
+ * Entries are keyed by FormID plus a fingerprint of everything else the
+ * result depends on: the resolved alias values, the title and the sanitizer
+ * settings (see BookUtils::ReadBookSource, FindDocument and BuildDocument). A quest advancing changes the
+ * fingerprint, so stale text is simply never looked up again and ages out.
+ * Eviction is by the documents' memory use against a byte budget.
+ */
+class BookCache {
+public:
+  struct Key {
+    std::uint32_t formID = 0;
+    std::uint64_t fingerprint = 0;
+
+    bool operator==(const Key &) const = default;
+  };
+
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::uint64_t entries = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t budget = 0;
+  };
+
+  [[nodiscard]] static BookCache *GetSingleton();
+
+  // Byte budget for all cached documents; evicts down to it right away
+  void SetBudget(std::size_t bytes);
+
+  // Cached document for the key (null on a miss); marks it recently used
+  [[nodiscard]] std::shared_ptr<const BookDocument> Find(const Key &key);
+
+  // Check for an entry without counting a lookup or touching the LRU order
+  [[nodiscard]] bool Contains(const Key &key) const;
+
+  // Store a document; documents larger than the whole budget are not kept
+  void Insert(const Key &key, std::shared_ptr<const BookDocument> document);
+
+  void Clear();
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  BookCache() = default;
+  ~BookCache() = default;
+  BookCache(const BookCache &) = delete;
+  BookCache(BookCache &&) = delete;
+  BookCache &operator=(const BookCache &) = delete;
+  BookCache &operator=(BookCache &&) = delete;
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const noexcept;
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<const BookDocument> document;
+    std::size_t bytes;
+  };
+
+  using List = std::list<Entry>;
+
+  // Drop least recently used entries until the total fits the budget
+  void EvictLocked();
+
+  mutable std::mutex lock_;
+  List lru_; // Most recently used first
+  std::unordered_map<Key, List::iterator, KeyHash> index_;
+  std::size_t bytes_ = 0;
+  std::size_t budget_ = 16 * 1024 * 1024;
+
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+  std::atomic<std::uint64_t> evictions_{0};
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Easy2Read {
+
+enum class BookBlock : std::uint8_t {
+  Text,     // Body text
+  Image,    // Mapped replacement text of an <img>
+  PageBreak // Zero-length marker where a [pagebreak] was
+};
+
+enum class BookAlign : std::uint8_t { Left, Center, Right, Justify };
+
+// Text style set by the book's markup (<font>, <b>, <i>, <u>, <p align>)
+struct BookStyle {
+  enum Flag : std::uint8_t {
+    kBold = 1 << 0,
+    kItalic = 1 << 1,
+    kUnderline = 1 << 2,
+  };
+  static constexpr std::uint32_t kDefaultColor = 0xFFFFFFFF;
+
+  std::uint8_t flags = 0;
+  BookAlign align = BookAlign::Left;
+  std::uint8_t size = 0; // <font size>, 0 = not set
+  std::uint8_t face = 0; // Index into BookDocument::faces, 0 = not set
+  std::uint32_t color = kDefaultColor; // 0xRRGGBB from <font color>
+
+  bool operator==(const BookStyle &) const = default;
+};
+
+struct BookSpan {
+  std::uint32_t offset = 0; // Into BookDocument::text
+  std::uint32_t length = 0;
+  std::uint16_t style = 0; // Index into BookDocument::styles
+  BookBlock block = BookBlock::Text;
+};
+
+// One line of text between newlines; empty paragraphs are blank lines
+struct BookParagraph {
+  std::uint32_t offset = 0; // Into BookDocument::text, excluding the '\n'
+  std::uint32_t length = 0;
+  std::uint16_t style = 0;  // Style at the start of the line
+  bool pageBreak = false;   // A [pagebreak] precedes or falls inside the line
+};
+
+/**
+ * A book parsed once into display text plus the structure of its markup.
+ * `text` is the arena: the cleaned, sanitized text exactly as the
+ * BookPipeline writes it, so it can be shown or searched as a whole. Spans and
+ * paragraphs index into it, so nothing is re-derived when it is drawn.
+ */
+struct BookDocument {
+  std::string title;
+  std::string text;
+  std::vector<BookSpan> spans;           // In text order; never contain '\n'
+  std::vector<BookParagraph> paragraphs; // In text order
+  std::vector<BookStyle> styles;         // styles[0] is the default style
+  std::vector<std::string> faces;        // faces[0] is "" (not set)
+  std::vector<std::uint32_t> pages;      // Text offset of each page's start
+
+  [[nodiscard]] std::string_view GetText(std::uint32_t offset,
+                                         std::uint32_t length) const {
+    return std::string_view(text).substr(offset, length);
+  }
+
+  [[nodiscard]] const BookStyle &GetStyle(std::uint16_t id) const {
+    return id < styles.size() ? styles[id] : styles.front();
+  }
+
+  // Pages are separated by [pagebreak] markers; a book without any has one
+  [[nodiscard]] std::size_t GetPageCount() const {
+    return pages.empty() ? 1 : pages.size();
+  }
+
+  // Text range [begin, end) of a page
+  [[nodiscard]] std::pair<std::uint32_t, std::uint32_t>
+  GetPageRange(std::size_t page) const {
+    const auto size = static_cast<std::uint32_t>(text.size());
+    if (page >= pages.size()) {
+      return page == 0 ? std::pair{0u, size} : std::pair{size, size};
+    }
+    return {pages[page], page + 1 < pages.size() ? pages[page + 1] : size};
+  }
+
+  // Heap bytes held by the document (for cache budgets)
+  [[nodiscard]] std::size_t GetMemoryUsage() const {
+    std::size_t bytes = sizeof(BookDocument) + title.capacity() +
+                        text.capacity() +
+                        spans.capacity() * sizeof(BookSpan) +
+                        paragraphs.capacity() * sizeof(BookParagraph) +
+                        styles.capacity() * sizeof(BookStyle) +
+                        pages.capacity() * sizeof(std::uint32_t) +
+                        faces.capacity() * sizeof(std::string);
+    for (const auto &face : faces) {
+      bytes += face.capacity();
+    }
+    return bytes;
+  }
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,281 @@
+#include "BookLibrary.h"
+#include "BookDocument.h"
+#include "PCH.h"
+
+#include <chrono>
+#include <type_traits>
+
+namespace Easy2Read {
+
+namespace {
+
+// Leads each packed document in the blob; the arrays follow in this order
+struct PackedHeader {
+  std::uint32_t titleSize = 0;
+  std::uint32_t textSize = 0;
+  std::uint32_t spanCount = 0;
+  std::uint32_t paragraphCount = 0;
+  std::uint32_t styleCount = 0;
+  std::uint32_t pageCount = 0;
+  std::uint32_t faceCount = 0; // Faces follow as NUL-terminated strings
+};
+
+template <class T>
+void AppendArray(std::string &blob, const std::vector<T> &values) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  blob.append(reinterpret_cast<const char *>(values.data()),
+              values.size() * sizeof(T));
+}
+
+template <class T>
+const char *ReadArray(const char *data, std::uint32_t count,
+                      std::vector<T> &values) {
+  values.resize(count);
+  if (count) {
+    std::memcpy(values.data(), data, count * sizeof(T));
+  }
+  return data + count * sizeof(T);
+}
+
+void Pack(const BookDocument &document, std::string &blob) {
+  PackedHeader header;
+  header.titleSize = static_cast<std::uint32_t>(document.title.size());
+  header.textSize = static_cast<std::uint32_t>(document.text.size());
+  header.spanCount = static_cast<std::uint32_t>(document.spans.size());
+  header.paragraphCount =
+      static_cast<std::uint32_t>(document.paragraphs.size());
+  header.styleCount = static_cast<std::uint32_t>(document.styles.size());
+  header.pageCount = static_cast<std::uint32_t>(document.pages.size());
+  header.faceCount = static_cast<std::uint32_t>(document.faces.size());
+
+  blob.append(reinterpret_cast<const char *>(&header), sizeof(header));
+  blob.append(document.title);
+  blob.append(document.text);
+  AppendArray(blob, document.spans);
+  AppendArray(blob, document.paragraphs);
+  AppendArray(blob, document.styles);
+  AppendArray(blob, document.pages);
+  for (const auto &face : document.faces) {
+    blob.append(face);
+    blob.push_back('\0');
+  }
+}
+
+std::shared_ptr<const BookDocument> Unpack(const char *data) {
+  PackedHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  data += sizeof(header);
+
+  auto document = std::make_shared<BookDocument>();
+  document->title.assign(data, header.titleSize);
+  data += header.titleSize;
+  document->text.assign(data, header.textSize);
+  data += header.textSize;
+  data = ReadArray(data, header.spanCount, document->spans);
+  data = ReadArray(data, header.paragraphCount, document->paragraphs);
+  data = ReadArray(data, header.styleCount, document->styles);
+  data = ReadArray(data, header.pageCount, document->pages);
+  document->faces.reserve(header.faceCount);
+  for (std::uint32_t i = 0; i < header.faceCount; ++i) {
+    const std::string_view face(data);
+    document->faces.emplace_back(face);
+    data += face.size() + 1;
+  }
+  return document;
+}
+
+} // namespace
+
+BookLibrary *BookLibrary::GetSingleton() {
+  static BookLibrary singleton;
+  return &singleton;
+}
+
+void BookLibrary::Build() {
+  if (builder_.joinable() || IsReady()) {
+    return;
+  }
+  auto *dataHandler = RE::TESDataHandler::GetSingleton();
+  if (!dataHandler) {
+    return;
+  }
+
+  // Forms are only read here; the builder thread gets copies
+  const auto start = std::chrono::steady_clock::now();
+  const auto &books = dataHandler->GetFormArray<RE::TESObjectBOOK>();
+  std::vector<BookUtils::BookSource> sources;
+  sources.reserve(books.size());
+  std::size_t rawBytes = 0;
+  for (auto *book : books) {
+    if (!book) {
+      continue;
+    }
+    auto source = BookUtils::ReadStaticBookSource(book);
+    if (!source) {
+      aliasBooks_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    rawBytes += source->raw.size();
+    sources.push_back(std::move(*source));
+  }
+
+  const auto copyMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  SKSE::log::info("BookLibrary: Copied {} books ({} KB) in {} ms; {} use "
+                  "quest aliases and are processed when opened",
+                  sources.size(), rawBytes / 1024, copyMs,
+                  aliasBooks_.load(std::memory_order_relaxed));
+
+  builder_ = std::thread(&BookLibrary::Run, this, std::move(sources));
+}
+
+void BookLibrary::Run(std::vector<BookUtils::BookSource> sources) {
+  const auto start = std::chrono::steady_clock::now();
+
+  // Leave a core to the game, which is still starting up
+  const unsigned cores = (std::max)(1u, std::thread::hardware_concurrency());
+  const std::size_t workerCount = (std::max)(
+      std::size_t{1},
+      (std::min)(static_cast<std::size_t>(cores - (cores > 1 ? 1 : 0)),
+                 sources.size()));
+
+  // Each worker packs into its own shard; shards are joined at the end
+  std::vector<Library> shards(workerCount);
+  std::atomic<std::size_t> next{0};
+  const auto work = [this, &sources, &next](Library &shard) {
+    BookDocument document; // Capacity reused from book to book
+    for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+         i < sources.size() &&
+         !stopRequested_.load(std::memory_order_relaxed);
+         i = next.fetch_add(1, std::memory_order_relaxed)) {
+      const auto &source = sources[i];
+      BookUtils::ParseDocument(source, document);
+
+      Entry entry;
+      entry.formID = source.key.formID;
+      entry.fingerprint = source.key.fingerprint;
+      entry.offset = shard.blob.size();
+      Pack(document, shard.blob);
+      shard.index.push_back(entry);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(workerCount - 1);
+  for (std::size_t i = 1; i < workerCount; ++i) {
+    workers.emplace_back(work, std::ref(shards[i]));
+  }
+  work(shards[0]);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  if (stopRequested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  auto library = std::make_shared<Library>();
+  std::size_t blobSize = 0;
+  for (const auto &shard : shards) {
+    blobSize += shard.blob.size();
+  }
+  library->blob.reserve(blobSize);
+  library->index.reserve(sources.size());
+  for (auto &shard : shards) {
+    const std::size_t base = library->blob.size();
+    library->blob.append(shard.blob);
+    for (auto entry : shard.index) {
+      entry.offset += base;
+      library->index.push_back(entry);
+    }
+    shard = Library{};
+  }
+  std::sort(library->index.begin(), library->index.end(),
+            [](const Entry &a, const Entry &b) { return a.formID < b.formID; });
+
+  const auto buildMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  SKSE::log::info("BookLibrary: Processed {} books in {} ms on {} thread(s); "
+                  "{:.1f} MB blob, {} KB index",
+                  library->index.size(), buildMs, workerCount,
+                  static_cast<double>(library->blob.size()) / (1024.0 * 1024.0),
+                  library->index.size() * sizeof(Entry) / 1024);
+  library_.store(std::move(library));
+}
+
+BookLibrary::~BookLibrary() {
+  // Only reached at process teardown without Shutdown(), when Windows has
+  // already ended the builder; joining it would never return
+  if (builder_.joinable()) {
+    builder_.detach();
+  }
+}
+
+void BookLibrary::Shutdown() {
+  stopRequested_.store(true, std::memory_order_relaxed);
+  if (builder_.joinable()) {
+    builder_.join();
+  }
+}
+
+const BookLibrary::Entry *
+BookLibrary::FindEntry(const Library &library,
+                       const BookCache::Key &key) const {
+  const auto it = std::lower_bound(
+      library.index.begin(), library.index.end(), key.formID,
+      [](const Entry &entry, std::uint32_t formID) {
+        return entry.formID < formID;
+      });
+  if (it == library.index.end() || it->formID != key.formID ||
+      it->fingerprint != key.fingerprint) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+std::shared_ptr<const BookDocument>
+BookLibrary::Find(const BookCache::Key &key) {
+  const auto library = library_.load();
+  if (!library) {
+    return nullptr;
+  }
+  const auto *entry = FindEntry(*library, key);
+  if (!entry) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return Unpack(library->blob.data() + entry->offset);
+}
+
+bool BookLibrary::Contains(const BookCache::Key &key) const {
+  const auto library = library_.load();
+  return library && FindEntry(*library, key) != nullptr;
+}
+
+BookLibrary::Stats BookLibrary::GetStats() const {
+  Stats stats;
+  if (const auto library = library_.load()) {
+    stats.books = library->index.size();
+    stats.bytes = library->blob.size();
+  }
+  stats.aliasBooks = aliasBooks_.load(std::memory_order_relaxed);
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void BookLibrary::LogStats() const {
+  const auto stats = GetStats();
+  if (!stats.books) {
+    return;
+  }
+  SKSE::log::info("BookLibrary: {} books ({:.1f} MB), {} opened from the "
+                  "library, {} not found (aliases or changed settings)",
+                  stats.books,
+                  static_cast<double>(stats.bytes) / (1024.0 * 1024.0),
+                  stats.hits, stats.misses);
+}
+
+} // namespace Easy2Read
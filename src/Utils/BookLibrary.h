@@ -0,0 +1,94 @@
+#pragma once
+
+#include "BookCache.h"
+#include "BookUtils.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Easy2Read {
+
+struct BookDocument;
+
+/**
+ * Every book in the load order processed once at data load, so opening a
+ * book only has to read its title and find it here.
+ *
+ * Book texts are copied on the game thread, then a background thread runs
+ * them through the BookPipeline on all but one core and packs the documents
+ * into one contiguous blob with a FormID-sorted offset index. Books whose
+ * text or title uses quest aliases depend on the game state and are left to
+ * the normal path. Entries carry the same fingerprint as BookCache keys, so
+ * a changed title or sanitizer setting simply misses.
+ */
+class BookLibrary {
+public:
+  struct Stats {
+    std::uint64_t books = 0;      // Documents in the library
+    std::uint64_t aliasBooks = 0; // Left to the book menu (quest aliases)
+    std::uint64_t bytes = 0;      // Blob size
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+  };
+
+  [[nodiscard]] static BookLibrary *GetSingleton();
+
+  // Copy every book's text and start processing them (game thread, once)
+  void Build();
+
+  // Stop an unfinished build and join its thread
+  void Shutdown();
+
+  [[nodiscard]] bool IsReady() const { return library_.load() != nullptr; }
+
+  // Unpacked document for the key, or null if it isn't in the library (yet)
+  [[nodiscard]] std::shared_ptr<const BookDocument>
+  Find(const BookCache::Key &key);
+
+  // Check for an entry without counting a lookup
+  [[nodiscard]] bool Contains(const BookCache::Key &key) const;
+
+  [[nodiscard]] Stats GetStats() const;
+  void LogStats() const;
+
+private:
+  BookLibrary() = default;
+  ~BookLibrary();
+  BookLibrary(const BookLibrary &) = delete;
+  BookLibrary(BookLibrary &&) = delete;
+  BookLibrary &operator=(const BookLibrary &) = delete;
+  BookLibrary &operator=(BookLibrary &&) = delete;
+
+  struct Entry {
+    std::uint32_t formID = 0;
+    std::uint64_t fingerprint = 0;
+    std::size_t offset = 0; // Into Library::blob
+  };
+
+  // Immutable once published
+  struct Library {
+    std::string blob;
+    std::vector<Entry> index; // Sorted by FormID
+  };
+
+  // Process the copied books and publish the library (builder thread)
+  void Run(std::vector<BookUtils::BookSource> sources);
+
+  [[nodiscard]] const Entry *FindEntry(const Library &library,
+                                       const BookCache::Key &key) const;
+
+  std::atomic<std::shared_ptr<const Library>> library_;
+  std::atomic<bool> stopRequested_{false};
+  std::thread builder_;
+
+  std::atomic<std::uint64_t> aliasBooks_{0};
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+};
+
+} // namespace Easy2Read
@@ -0,0 +1,886 @@
+#include "BookPipeline.h"
+#include "BookDocument.h"
+#include "HtmlEntities.h"
+#include "PCH.h"
+#include "TextSanitization/TextSanitizer.h"
+#include <bit>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define E2R_HAS_SSE2 1
+#endif
+
+namespace Easy2Read {
+
+namespace {
+
+// A stage is any type with `bool Next(Unit &u)`, returning false once the
+// text is exhausted. Stages own their upstream by value, so the compiler sees
+// the whole chain and inlines it into the output loop. Each byte carries the
+// style, block and page it came from; the text stages only look at the byte.
+struct Unit {
+  char c = 0;
+  BookBlock block = BookBlock::Text;
+  std::uint16_t style = 0;
+  std::uint16_t page = 0;
+};
+
+bool IsSpace(char c) { return c == ' ' || c == '\t'; }
+bool IsNewline(char c) { return c == '\n' || c == '\r'; }
+bool IsWhitespace(char c) { return IsSpace(c) || IsNewline(c); }
+
+char ToLowerAscii(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+  return a.size() == b.size() &&
+         std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+           return ToLowerAscii(x) == ToLowerAscii(y);
+         });
+}
+
+std::string_view Trim(std::string_view text) {
+  const auto start = text.find_first_not_of(" \t\r\n");
+  if (start == std::string_view::npos) {
+    return text;
+  }
+  const auto end = text.find_last_not_of(" \t\r\n");
+  return text.substr(start, end - start + 1);
+}
+
+// Position of the first markup anchor ('<', '>', '&' or '[') at or after
+// `pos`, or npos. SSE2 (always present on x64) tests 16 bytes per step.
+std::size_t FindMarkupAnchor(std::string_view text, std::size_t pos) {
+  const auto isAnchor = [](char c) {
+    return c == '<' || c == '>' || c == '&' || c == '[';
+  };
+  const char *data = text.data();
+  const std::size_t size = text.size();
+
+#ifdef E2R_HAS_SSE2
+  const __m128i lt = _mm_set1_epi8('<');
+  const __m128i gt = _mm_set1_epi8('>');
+  const __m128i amp = _mm_set1_epi8('&');
+  const __m128i bracket = _mm_set1_epi8('[');
+  for (; pos + 16 <= size; pos += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+    const __m128i hits =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, gt)),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, amp),
+                                  _mm_cmpeq_epi8(v, bracket)));
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+    if (mask != 0) {
+      return pos + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+#endif
+
+  for (; pos < size; ++pos) {
+    if (isAnchor(data[pos])) {
+      return pos;
+    }
+  }
+  return std::string_view::npos;
+}
+
+// Value of an attribute in a complete tag (name matched case-insensitively),
+// or "" if the tag doesn't have it
+std::string_view GetAttribute(std::string_view tag, std::string_view name) {
+  for (std::size_t pos = 1; pos + name.size() < tag.size(); ++pos) {
+    if (!IsWhitespace(tag[pos - 1]) ||
+        !EqualsIgnoreCase(tag.substr(pos, name.size()), name)) {
+      continue;
+    }
+    std::size_t i = pos + name.size();
+    while (i < tag.size() && IsSpace(tag[i])) {
+      ++i;
+    }
+    if (i >= tag.size() || tag[i] != '=') {
+      continue;
+    }
+    ++i;
+    while (i < tag.size() && IsSpace(tag[i])) {
+      ++i;
+    }
+    if (i < tag.size() && (tag[i] == '"' || tag[i] == '\'')) {
+      const auto end = tag.find(tag[i], i + 1);
+      return end == std::string_view::npos ? std::string_view{}
+                                           : tag.substr(i + 1, end - i - 1);
+    }
+    const auto end = tag.find_first_of(" \t\r\n>", i);
+    return tag.substr(i, end == std::string_view::npos ? end : end - i);
+  }
+  return {};
+}
+
+// Follows <font>, <b>/<strong>, <i>/<em>, <u> and <p align> while a document
+// is built, interning each distinct combination in the document's style table
+class StyleTracker {
+public:
+  explicit StyleTracker(BookDocument &document) : document_(document) {
+    document_.styles.assign(1, BookStyle{});
+    document_.faces.assign(1, std::string{});
+  }
+
+  [[nodiscard]] std::uint16_t Current() const { return current_; }
+
+  // Apply a complete tag, "<...>"
+  void OnTag(std::string_view tag) {
+    std::size_t pos = 1;
+    const bool closing = pos < tag.size() && tag[pos] == '/';
+    if (closing) {
+      ++pos;
+    }
+    std::size_t end = pos;
+    while (end < tag.size() && !IsWhitespace(tag[end]) && tag[end] != '>' &&
+           tag[end] != '/') {
+      ++end;
+    }
+    const std::string_view name = tag.substr(pos, end - pos);
+    const int step = closing ? -1 : 1;
+
+    if (EqualsIgnoreCase(name, "p")) {
+      align_ = closing ? BookAlign::Left : ParseAlign(GetAttribute(tag, "align"));
+    } else if (EqualsIgnoreCase(name, "font")) {
+      if (!closing) {
+        fonts_.push_back(ParseFont(tag));
+      } else if (!fonts_.empty()) {
+        fonts_.pop_back();
+      }
+    } else if (EqualsIgnoreCase(name, "b") || EqualsIgnoreCase(name, "strong")) {
+      bold_ = (std::max)(bold_ + step, 0);
+    } else if (EqualsIgnoreCase(name, "i") || EqualsIgnoreCase(name, "em")) {
+      italic_ = (std::max)(italic_ + step, 0);
+    } else if (EqualsIgnoreCase(name, "u")) {
+      underline_ = (std::max)(underline_ + step, 0);
+    } else {
+      return;
+    }
+    Update();
+  }
+
+private:
+  static BookAlign ParseAlign(std::string_view value) {
+    if (EqualsIgnoreCase(value, "center")) {
+      return BookAlign::Center;
+    }
+    if (EqualsIgnoreCase(value, "right")) {
+      return BookAlign::Right;
+    }
+    if (EqualsIgnoreCase(value, "justify")) {
+      return BookAlign::Justify;
+    }
+    return BookAlign::Left;
+  }
+
+  // Face, size and color of a <font> tag; unset ones inherit the outer font
+  BookStyle ParseFont(std::string_view tag) {
+    BookStyle font = fonts_.empty() ? BookStyle{} : fonts_.back();
+
+    if (const auto face = GetAttribute(tag, "face"); !face.empty()) {
+      font.face = InternFace(face);
+    }
+    if (const auto size = GetAttribute(tag, "size"); !size.empty()) {
+      unsigned value = 0;
+      for (const char c : size) {
+        if (c < '0' || c > '9') {
+          break;
+        }
+        value = (std::min)(value * 10 + static_cast<unsigned>(c - '0'), 255u);
+      }
+      font.size = static_cast<std::uint8_t>(value);
+    }
+    if (const auto color = GetAttribute(tag, "color");
+        color.size() == 7 && color.front() == '#') {
+      std::uint32_t value = 0;
+      bool valid = true;
+      for (const char c : color.substr(1)) {
+        int digit = -1;
+        if (c >= '0' && c <= '9') {
+          digit = c - '0';
+        } else if (ToLowerAscii(c) >= 'a' && ToLowerAscii(c) <= 'f') {
+          digit = ToLowerAscii(c) - 'a' + 10;
+        }
+        valid = valid && digit >= 0;
+        value = (value << 4) | static_cast<std::uint32_t>(digit & 0xF);
+      }
+      if (valid) {
+        font.color = value;
+      }
+    }
+    return font;
+  }
+
+  std::uint8_t InternFace(std::string_view face) {
+    auto &faces = document_.faces;
+    for (std::size_t i = 1; i < faces.size(); ++i) {
+      if (faces[i] == face) {
+        return static_cast<std::uint8_t>(i);
+      }
+    }
+    if (faces.size() > 0xFF) {
+      return 0;
+    }
+    faces.emplace_back(face);
+    return static_cast<std::uint8_t>(faces.size() - 1);
+  }
+
+  void Update() {
+    BookStyle style = fonts_.empty() ? BookStyle{} : fonts_.back();
+    style.align = align_;
+    style.flags = static_cast<std::uint8_t>(
+        (bold_ > 0 ? BookStyle::kBold : 0) |
+        (italic_ > 0 ? BookStyle::kItalic : 0) |
+        (underline_ > 0 ? BookStyle::kUnderline : 0));
+
+    // Books use a handful of styles, so a linear search is enough
+    auto &styles = document_.styles;
+    for (std::size_t i = 0; i < styles.size(); ++i) {
+      if (styles[i] == style) {
+        current_ = static_cast<std::uint16_t>(i);
+        return;
+      }
+    }
+    if (styles.size() > 0xFFFF) {
+      current_ = 0;
+      return;
+    }
+    styles.push_back(style);
+    current_ = static_cast<std::uint16_t>(styles.size() - 1);
+  }
+
+  BookDocument &document_;
+  std::vector<BookStyle> fonts_; // Open <font> tags, innermost last
+  int bold_ = 0;
+  int italic_ = 0;
+  int underline_ = 0;
+  BookAlign align_ = BookAlign::Left;
+  std::uint16_t current_ = 0;
+};
+
+// Fixed-size lookahead window over an upstream stage
+template <class Upstream, std::size_t N> class Lookahead {
+public:
+  explicit Lookahead(Upstream upstream) : upstream_(std::move(upstream)) {}
+
+  // Make at least `count` bytes available; false if the text ends first
+  bool Fill(std::size_t count) {
+    while (size_ < count) {
+      Unit u;
+      if (!upstream_.Next(u)) {
+        return false;
+      }
+      buffer_[(head_ + size_) % N] = u;
+      ++size_;
+    }
+    return true;
+  }
+
+  [[nodiscard]] const Unit &Peek(std::size_t index) const {
+    return buffer_[(head_ + index) % N];
+  }
+
+  void Skip(std::size_t count) {
+    head_ = (head_ + count) % N;
+    size_ -= count;
+  }
+
+  bool Next(Unit &u) {
+    if (!Fill(1)) {
+      return false;
+    }
+    u = Peek(0);
+    Skip(1);
+    return true;
+  }
+
+private:
+  Upstream upstream_;
+  Unit buffer_[N] = {};
+  std::size_t head_ = 0;
+  std::size_t size_ = 0;
+};
+
+// Source stage: reads the raw text and removes Scaleform/HTML-like markup.
+// <br> becomes a newline, </p> a blank line, <img> its mapped text.
+// Character references are decoded (see HtmlEntities); unknown names are
+// dropped and an '&' that doesn't start a reference is kept. [pagebreak]
+// markers (any case) are skipped here too. Text between anchors is handed on
+// as one run, so plain text costs a vector compare per 16 bytes.
+class MarkupStripper {
+public:
+  MarkupStripper(std::string_view text,
+                 const BookPipeline::ImageLookup &imageLookup,
+                 const TextSanitizer *sanitizer, StyleTracker *styles)
+      : text_(text), imageLookup_(imageLookup), sanitizer_(sanitizer),
+        styles_(styles) {}
+
+  bool Next(Unit &u) {
+    for (;;) {
+      if (pending_.empty() && !pendingTail_.empty()) {
+        pending_ = pendingTail_;
+        pendingTail_ = {};
+      }
+      if (!pending_.empty()) {
+        u = pendingUnit_;
+        u.c = pending_.front();
+        pending_.remove_prefix(1);
+        return true;
+      }
+      if (pos_ >= text_.size()) {
+        return false;
+      }
+
+      const auto anchor = FindMarkupAnchor(text_, pos_);
+      if (anchor != pos_) {
+        const auto end = (std::min)(anchor, text_.size());
+        if (!inTag_) {
+          SetPending(text_.substr(pos_, end - pos_));
+        }
+        pos_ = end;
+        continue;
+      }
+
+      switch (text_[pos_]) {
+      case '&':
+        ReadEntity();
+        break;
+      case '<':
+        ReadTag();
+        break;
+      case '>':
+        inTag_ = false;
+        ++pos_;
+        break;
+      default: // '['
+        if (IsPagebreak(text_.substr(pos_))) {
+          pos_ += kPagebreak.size();
+          if (page_ < 0xFFFF) {
+            ++page_;
+          }
+        } else {
+          if (!inTag_) {
+            SetPending(text_.substr(pos_, 1));
+          }
+          ++pos_;
+        }
+        break;
+      }
+    }
+  }
+
+private:
+  static constexpr std::string_view kPagebreak = "[pagebreak]";
+
+  static bool IsPagebreak(std::string_view text) {
+    return text.size() >= kPagebreak.size() &&
+           EqualsIgnoreCase(text.substr(0, kPagebreak.size()), kPagebreak);
+  }
+
+  // Queue bytes to emit under the current style
+  void SetPending(std::string_view bytes, BookBlock block = BookBlock::Text) {
+    pending_ = bytes;
+    pendingUnit_.block = block;
+    pendingUnit_.style = styles_ ? styles_->Current() : 0;
+    pendingUnit_.page = page_;
+  }
+
+  void ReadEntity() {
+    const auto decoded = HtmlEntities::Decode(text_.substr(pos_));
+    if (!decoded) {
+      if (!inTag_) {
+        SetPending(text_.substr(pos_, 1));
+      }
+      ++pos_;
+      return;
+    }
+    pos_ += decoded->length;
+    if (inTag_ || decoded->count == 0) {
+      return;
+    }
+    SetPending(EmitCodepoint(decoded->codepoints[0], encoded_));
+    if (decoded->count > 1) {
+      pendingTail_ = EmitCodepoint(decoded->codepoints[1], encoded_ + 4);
+    }
+  }
+
+  // Bytes for a decoded codepoint. Characters the game font lacks go through
+  // the sanitizer's transliteration table here, while the codepoint is known.
+  std::string_view EmitCodepoint(char32_t codepoint, char *buffer) const {
+    if (codepoint == 0xA0) {
+      return " "; // &nbsp; takes part in whitespace collapsing
+    }
+    if (sanitizer_ && sanitizer_->GetMode() == SanitizationMode::AnyASCII &&
+        !sanitizer_->IsSupported(codepoint)) {
+      if (const auto replacement = sanitizer_->GetReplacement(codepoint);
+          !replacement.empty()) {
+        return replacement;
+      }
+    }
+    return {buffer, HtmlEntities::EncodeUtf8(codepoint, buffer)};
+  }
+
+  void ReadTag() {
+    const std::string_view rest = text_.substr(pos_);
+
+    if (rest.size() > 4 && EqualsIgnoreCase(rest.substr(0, 4), "<img")) {
+      const auto tagEnd = rest.find('>');
+      if (tagEnd != std::string_view::npos) {
+        ReadImage(rest.substr(0, tagEnd + 1));
+        pos_ += tagEnd + 1;
+        return;
+      }
+    }
+
+    // Special tags that should become newlines
+    if (rest.size() > 3) {
+      const std::string_view tagStart = rest.substr(0, 4);
+      if (tagStart == "<br>" || tagStart == "<BR>" || tagStart == "<br/" ||
+          tagStart == "<BR/") {
+        SetPending("\n");
+      } else if (tagStart == "</p>" || tagStart == "</P>") {
+        SetPending("\n\n");
+      }
+    }
+
+    // Style changes apply from the text after the tag
+    if (styles_) {
+      if (const auto tagEnd = rest.find('>');
+          tagEnd != std::string_view::npos) {
+        styles_->OnTag(rest.substr(0, tagEnd + 1));
+      }
+    }
+    inTag_ = true;
+    ++pos_;
+  }
+
+  void ReadImage(std::string_view tag) {
+    std::string_view src = GetAttribute(tag, "src");
+    constexpr std::string_view kScheme = "img://";
+    if (src.size() >= kScheme.size() &&
+        EqualsIgnoreCase(src.substr(0, kScheme.size()), kScheme)) {
+      src.remove_prefix(kScheme.size());
+    }
+
+    // If no mapping, the image is just removed (no output)
+    if (!src.empty() && imageLookup_) {
+      SetPending(imageLookup_(src), BookBlock::Image);
+    }
+  }
+
+  std::string_view text_;
+  const BookPipeline::ImageLookup &imageLookup_;
+  const TextSanitizer *sanitizer_;
+  StyleTracker *styles_; // Only set when building a BookDocument
+  std::size_t pos_ = 0;
+  bool inTag_ = false;
+  std::uint16_t page_ = 0; // [pagebreak] markers passed so far
+  std::string_view pending_;     // Replacement bytes still to emit
+  std::string_view pendingTail_; // Second character of a two-codepoint entity
+  Unit pendingUnit_;             // Style, block and page of the pending bytes
+  char encoded_[8] = {};         // UTF-8 of decoded entities
+};
+
+// Collapses runs of spaces/tabs to one space and runs of newlines to at most
+// one blank line; leading and trailing whitespace is dropped. Whitespace is
+// held back until the next visible character proves it isn't trailing.
+template <class Upstream> class WhitespaceNormalizer {
+public:
+  explicit WhitespaceNormalizer(Upstream upstream)
+      : upstream_(std::move(upstream)) {}
+
+  bool Next(Unit &u) {
+    if (flushing_) {
+      u = pending_[flushPos_++];
+      if (flushPos_ == pending_.size()) {
+        pending_.clear();
+        flushPos_ = 0;
+        flushing_ = false;
+      }
+      return true;
+    }
+
+    Unit in;
+    while (upstream_.Next(in)) {
+      if (!started_ && IsWhitespace(in.c)) {
+        continue;
+      }
+      if (IsNewline(in.c)) {
+        if (newlines_ < 2) {
+          in.c = '\n';
+          pending_.push_back(in);
+          ++newlines_;
+        }
+        continue;
+      }
+      if (IsSpace(in.c)) {
+        if (pending_.empty() || pending_.back().c != ' ') {
+          in.c = ' ';
+          pending_.push_back(in);
+          newlines_ = 0;
+        }
+        continue;
+      }
+
+      started_ = true;
+      if (pending_.empty()) {
+        u = in;
+        return true;
+      }
+      pending_.push_back(in);
+      newlines_ = 0;
+      flushing_ = true;
+      return Next(u);
+    }
+    return false;
+  }
+
+private:
+  Upstream upstream_;
+  bool started_ = false;
+  std::vector<Unit> pending_; // Collapsed whitespace (plus the byte after it)
+  std::size_t flushPos_ = 0;
+  bool flushing_ = false; // A visible byte arrived; emit pending_
+  int newlines_ = 0;      // Newlines at the end of pending_
+};
+
+// Removes the first line if it matches the title (case-insensitive), along
+// with the whitespace after it. Only buffers as much of the first line as
+// could still match.
+template <class Upstream> class DuplicateTitleStripper {
+public:
+  DuplicateTitleStripper(Upstream upstream, std::string_view title)
+      : upstream_(std::move(upstream)), title_(Trim(title)) {}
+
+  bool Next(Unit &u) {
+    if (!checked_) {
+      CheckFirstLine();
+    }
+    if (replayPos_ < head_.size()) {
+      u = head_[replayPos_++];
+      return true;
+    }
+    if (held_) {
+      held_ = false;
+      u = heldUnit_;
+      return true;
+    }
+    return upstream_.Next(u);
+  }
+
+private:
+  void CheckFirstLine() {
+    checked_ = true;
+    if (title_.empty() || IsWhitespace(title_.front())) {
+      return;
+    }
+
+    head_.reserve(title_.size() + 2);
+    std::size_t leading = 0;
+    bool newline = false;
+    Unit in;
+    while (upstream_.Next(in)) {
+      head_.push_back(in);
+      if (in.c == '\n') {
+        newline = true;
+        break;
+      }
+      if (head_.size() == leading + 1 && IsWhitespace(in.c)) {
+        ++leading;
+      } else if (!IsWhitespace(in.c) &&
+                 head_.size() > leading + title_.size()) {
+        return; // Longer than the title, can't match
+      }
+    }
+
+    std::string line;
+    line.reserve(head_.size());
+    for (const auto &unit : head_) {
+      line.push_back(unit.c);
+    }
+    if (newline) {
+      line.pop_back();
+    }
+    if (!EqualsIgnoreCase(Trim(line), title_)) {
+      return;
+    }
+
+    head_.clear();
+    if (newline) {
+      while (upstream_.Next(in)) {
+        if (!IsWhitespace(in.c)) {
+          held_ = true;
+          heldUnit_ = in;
+          break;
+        }
+      }
+    }
+    SKSE::log::debug("BookPipeline: Removed duplicate title from body");
+  }
+
+  Upstream upstream_;
+  std::string_view title_;
+  bool checked_ = false;
+  std::vector<Unit> head_; // First line read while checking
+  std::size_t replayPos_ = 0;
+  bool held_ = false;
+  Unit heldUnit_;
+};
+
+// Tightens a standalone "by" line (any case): "\n\nby\n\n" -> "\nby\n", and a
+// leading "by\n\n" -> "by\n". The window only looks ahead at a newline.
+template <class Upstream> class BylineCleaner {
+public:
+  explicit BylineCleaner(Upstream upstream) : in_(std::move(upstream)) {}
+
+  bool Next(Unit &u) {
+    if (outPos_ < outSize_) {
+      u = out_[outPos_++];
+      return true;
+    }
+    outPos_ = 0;
+    outSize_ = 0;
+
+    // Leading "by\n\n": pass "by" through and decide on the blank line once
+    // the middle pattern had its chance (it wins when the lines repeat)
+    bool leadingBy = false;
+    if (atStart_) {
+      atStart_ = false;
+      if (in_.Fill(4) && IsBy(0) && in_.Peek(2).c == '\n' &&
+          in_.Peek(3).c == '\n') {
+        out_[outSize_++] = in_.Peek(0);
+        out_[outSize_++] = in_.Peek(1);
+        in_.Skip(2);
+        leadingBy = true;
+      }
+    }
+
+    if (in_.Fill(1) && in_.Peek(0).c == '\n' && in_.Fill(kLength) &&
+        in_.Peek(1).c == '\n' && IsBy(2) && in_.Peek(4).c == '\n' &&
+        in_.Peek(5).c == '\n') {
+      out_[outSize_++] = in_.Peek(1);
+      out_[outSize_++] = in_.Peek(2);
+      out_[outSize_++] = in_.Peek(3);
+      out_[outSize_++] = in_.Peek(4);
+      in_.Skip(kLength);
+      SKSE::log::debug("BookPipeline: Cleaned 'by' pattern (middle)");
+    } else if (leadingBy) {
+      out_[outSize_++] = in_.Peek(0);
+      in_.Skip(2);
+      SKSE::log::debug("BookPipeline: Cleaned 'by' pattern (start)");
+    }
+
+    if (outSize_ > 0) {
+      return Next(u);
+    }
+    return in_.Next(u);
+  }
+
+private:
+  static constexpr std::size_t kLength = 6;
+
+  bool IsBy(std::size_t at) const {
+    return ToLowerAscii(in_.Peek(at).c) == 'b' &&
+           ToLowerAscii(in_.Peek(at + 1).c) == 'y';
+  }
+
+  Lookahead<Upstream, kLength> in_;
+  bool atStart_ = true;
+  Unit out_[6] = {};
+  std::size_t outPos_ = 0;
+  std::size_t outSize_ = 0;
+};
+
+template <class Stage> void Drain(Stage &stage, std::string &output) {
+  Unit u;
+  while (stage.Next(u)) {
+    output.push_back(u.c);
+  }
+}
+
+// Sanitize `text` in its own buffer, using spare capacity for expansion
+void SanitizeInPlace(const TextSanitizer &sanitizer, std::string &text) {
+  if (!sanitizer.NeedsSanitization(text)) {
+    return;
+  }
+
+  thread_local std::string overflow;
+  const std::size_t size = text.size();
+  text.resize(text.capacity());
+  const auto result =
+      sanitizer.SanitizeInPlace(text.data(), size, text.size(), overflow);
+  if (result.inPlace) {
+    text.resize(result.length);
+  } else {
+    text.swap(overflow);
+    overflow.clear();
+  }
+}
+
+// Final stage when building a document: cuts the stream into runs of one
+// style and block, sanitizes each run into the text arena and records its
+// span. Newlines end paragraphs and sit between spans.
+class DocumentWriter {
+public:
+  DocumentWriter(BookDocument &document, const TextSanitizer *sanitizer)
+      : document_(document), sanitizer_(sanitizer) {
+    document_.pages.assign(1, 0);
+  }
+
+  void Push(const Unit &u) {
+    if (!paragraphOpen_) {
+      OpenParagraph(u.style);
+    }
+    if (u.c == '\n') {
+      FlushRun();
+      CloseParagraph();
+      document_.text.push_back('\n');
+      return;
+    }
+
+    // A page starts at its first visible byte, not at the line breaks
+    // left over from the end of the previous page
+    if (u.page != page_) {
+      FlushRun();
+      AddSpan(document_.text.size(), 0, u.style, BookBlock::PageBreak);
+      // Breaks with nothing before them don't make empty pages
+      const auto offset = static_cast<std::uint32_t>(document_.text.size());
+      if (offset != document_.pages.back()) {
+        document_.pages.push_back(offset);
+      }
+      paragraphPageBreak_ = true;
+      page_ = u.page;
+    }
+    if (!run_.empty() && (u.style != runStyle_ || u.block != runBlock_)) {
+      FlushRun();
+    }
+    if (run_.empty()) {
+      runStyle_ = u.style;
+      runBlock_ = u.block;
+    }
+    run_.push_back(u.c);
+  }
+
+  void Finish() {
+    FlushRun();
+    if (paragraphOpen_) {
+      CloseParagraph();
+    }
+  }
+
+private:
+  void FlushRun() {
+    if (run_.empty()) {
+      return;
+    }
+    const auto offset = document_.text.size();
+    if (sanitizer_ && sanitizer_->NeedsSanitization(run_)) {
+      sanitizer_->SanitizeTo(run_, scratch_);
+      document_.text += scratch_;
+    } else {
+      document_.text += run_;
+    }
+    AddSpan(offset, document_.text.size() - offset, runStyle_, runBlock_);
+    run_.clear();
+  }
+
+  void AddSpan(std::size_t offset, std::size_t length, std::uint16_t style,
+               BookBlock block) {
+    BookSpan span;
+    span.offset = static_cast<std::uint32_t>(offset);
+    span.length = static_cast<std::uint32_t>(length);
+    span.style = style;
+    span.block = block;
+    document_.spans.push_back(span);
+  }
+
+  void OpenParagraph(std::uint16_t style) {
+    paragraphOpen_ = true;
+    paragraphStart_ = document_.text.size();
+    paragraphStyle_ = style;
+    paragraphPageBreak_ = false;
+  }
+
+  void CloseParagraph() {
+    BookParagraph paragraph;
+    paragraph.offset = static_cast<std::uint32_t>(paragraphStart_);
+    paragraph.length =
+        static_cast<std::uint32_t>(document_.text.size() - paragraphStart_);
+    paragraph.style = paragraphStyle_;
+    paragraph.pageBreak = paragraphPageBreak_;
+    document_.paragraphs.push_back(paragraph);
+    paragraphOpen_ = false;
+  }
+
+  BookDocument &document_;
+  const TextSanitizer *sanitizer_;
+  std::string run_;     // Bytes of the current span, before sanitizing
+  std::string scratch_; // Sanitized copy of run_
+  std::uint16_t runStyle_ = 0;
+  BookBlock runBlock_ = BookBlock::Text;
+  std::uint16_t page_ = 0;
+  bool paragraphOpen_ = false;
+  std::size_t paragraphStart_ = 0;
+  std::uint16_t paragraphStyle_ = 0;
+  bool paragraphPageBreak_ = false;
+};
+
+} // namespace
+
+void BookPipeline::Process(std::string_view raw, const Options &options,
+                           std::string &output) {
+  output.clear();
+  // Markup only shrinks the text; the extra quarter leaves room for image
+  // replacements and for the sanitizer to expand in place
+  output.reserve(raw.size() + raw.size() / 4);
+
+  BylineCleaner stage(DuplicateTitleStripper(
+      WhitespaceNormalizer(MarkupStripper(raw, options.imageLookup,
+                                          options.sanitizer, nullptr)),
+      options.title));
+  Drain(stage, output);
+
+  if (options.sanitizer) {
+    SanitizeInPlace(*options.sanitizer, output);
+  }
+}
+
+void BookPipeline::Process(std::string_view raw, const Options &options,
+                           BookDocument &document) {
+  document.text.clear();
+  document.spans.clear();
+  document.paragraphs.clear();
+  document.text.reserve(raw.size() + raw.size() / 4);
+
+  StyleTracker styles(document);
+  BylineCleaner stage(DuplicateTitleStripper(
+      WhitespaceNormalizer(MarkupStripper(raw, options.imageLookup,
+                                          options.sanitizer, &styles)),
+      options.title));
+
+  DocumentWriter writer(document, options.sanitizer);
+  Unit u;
+  while (stage.Next(u)) {
+    writer.Push(u);
+  }
+  writer.Finish();
+
+  // The document is kept for as long as the book is cached
+  document.text.shrink_to_fit();
+  document.spans.shrink_to_fit();
+  document.paragraphs.shrink_to_fit();
+  document.pages.shrink_to_fit();
+}
+
+std::string BookPipeline::StripMarkup(std::string_view text,
+                                      const ImageLookup &imageLookup) {
+  std::string result;
+  result.reserve(text.size());
+  MarkupStripper markup(text, imageLookup, nullptr, nullptr);
+  Drain(markup, result);
+  return result;
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Easy2Read {
+
+class TextSanitizer;
+struct BookDocument;
+
+/**
+ * Single-pass book text cleanup (markup, pagebreaks, whitespace, duplicate
+ * title, "by" line, sanitization).
+ *
+ * Each stage is a pull-based transformer that asks the stage before it for
+ * one byte at a time and only buffers the few bytes it needs to look ahead,
+ * so the whole chain reads the raw text once and writes straight into one
+ * pre-reserved output string. Sanitization then rewrites that string in
+ * place. Independent of CommonLibSSE so desktop tools can run it.
+ */
+class BookPipeline {
+public:
+  // Replacement text for an <img> source path ("" removes the image). The
+  // returned view must stay valid until Process returns.
+  using ImageLookup = std::function<std::string_view(std::string_view)>;
+
+  struct Options {
+    std::string_view title;           // Dropped if it repeats as line one
+    ImageLookup imageLookup;          // Optional; images removed if unset
+    const TextSanitizer *sanitizer = nullptr; // Optional final stage
+  };
+
+  /**
+   * Run the full chain over raw book text (aliases already resolved).
+   * @param raw Book text as stored in the DESC record
+   * @param options Title, image mappings and sanitizer to apply
+   * @param output Receives the display text; its capacity is reused
+   */
+  static void Process(std::string_view raw, const Options &options,
+                      std::string &output);
+
+  /**
+   * Run the full chain and keep the markup's structure: the document's text
+   * equals what the string overload produces, and its spans, paragraphs and
+   * styles describe that text. The title is left to the caller.
+   * @param document Receives text, spans, paragraphs, styles and faces
+   */
+  static void Process(std::string_view raw, const Options &options,
+                      BookDocument &document);
+
+  // Run only the markup stage (tags, entities, img replacement)
+  [[nodiscard]] static std::string
+  StripMarkup(std::string_view text, const ImageLookup &imageLookup = {});
+};
+
+} // namespace Easy2Read
@@ -1,391 +1,187 @@
 #include "BookUtils.h"
 #include "AliasResolver.h"
+#include "BookCache.h"
+#include "BookDocument.h"
+#include "BookLibrary.h"
+#include "Hash.h"
 #include "ImageMappings.h"
 #include "PCH.h"
 #include "TextSanitization/TextSanitizer.h"
 
 namespace Easy2Read {
 
-std::string BookUtils::GetBookTitle(RE::TESObjectBOOK *book) {
-  if (!book) {
-    return "";
-  }
-
-  const char *name = book->GetName();
-  std::string title = name ? name : "";
-
-  auto *aliasResolver = AliasResolver::GetSingleton();
-  title = aliasResolver->ResolveAliases(title, book);
-
-  // Apply text sanitization to title
-  auto *sanitizer = TextSanitizer::GetSingleton();
-  if (sanitizer->IsEnabled()) {
-    title = sanitizer->Sanitize(title);
-  }
+namespace {
 
-  return title;
+bool HasAliases(std::string_view text) {
+  return text.find("<Alias=") != std::string_view::npos ||
+         text.find("<alias=") != std::string_view::npos;
 }
 
-std::string BookUtils::GetBookText(RE::TESObjectBOOK *book) {
-  if (!book) {
-    return "";
-  }
-
-  RE::BSString description;
+// Description text with quest aliases resolved. Points into `description`,
+// or into `resolved` when the book uses aliases.
+std::string_view GetRawText(RE::TESObjectBOOK *book, RE::BSString &description,
+                            std::string &resolved) {
   book->GetDescription(description, nullptr);
 
-  std::string rawText = description.c_str();
+  std::string_view rawText(description.c_str(), description.length());
 
   // Debug: log raw text length
-  SKSE::log::info("BookUtils: Raw text length: {} bytes", rawText.size());
+  SKSE::log::debug("BookUtils: Raw text length: {} bytes", rawText.size());
 
   // Resolve quest aliases (<Alias=...> tags) BEFORE stripping markup
-  // Otherwise StripMarkup removes the alias tags before they can be resolved
-  auto *aliasResolver = AliasResolver::GetSingleton();
-  rawText = aliasResolver->ResolveAliases(rawText, book);
-
-  // Strip markup and normalize whitespace
-  std::string cleanText = StripMarkup(rawText);
-  cleanText = StripPagebreaks(cleanText);
-  cleanText = NormalizeWhitespace(cleanText);
-
-  // Get title for duplicate removal
-  std::string title = GetBookTitle(book);
-
-  // Remove first line if it matches the title
-  cleanText = RemoveDuplicateTitle(cleanText, title);
-
-  // Clean up "by" author pattern (blank line, "by", blank line -> "by")
-  cleanText = CleanByPattern(cleanText);
+  // Otherwise StripMarkup removes the alias tags before they can be resolved.
+  // Only books that use aliases pay for the extra copy.
+  if (HasAliases(rawText)) {
+    resolved = AliasResolver::GetSingleton()->ResolveAliases(
+        std::string(rawText), book);
+    rawText = resolved;
+  }
+  return rawText;
+}
 
-  // Debug: log clean text length
-  SKSE::log::info("BookUtils: Clean text length: {} bytes", cleanText.size());
+// Source for a book's text, with `resolved` holding the alias-resolved text
+// if the book uses aliases
+BookUtils::BookSource MakeSource(RE::TESObjectBOOK *book,
+                                 std::string_view rawText,
+                                 std::string resolved) {
+  BookUtils::BookSource source;
+  source.title = BookUtils::GetBookTitle(book);
 
-  // Apply text sanitization to remove unsupported Unicode
+  // The FormID fixes the raw text; the fingerprint covers what can change
+  // while playing: resolved alias values, the title and sanitizer settings
   auto *sanitizer = TextSanitizer::GetSingleton();
-  SKSE::log::info("BookUtils: Sanitizer enabled={}, mode={}",
-                  sanitizer->IsEnabled() ? "true" : "false",
-                  static_cast<int>(sanitizer->GetMode()));
-
-  if (sanitizer->IsEnabled()) {
-    bool needsSanitization = sanitizer->NeedsSanitization(cleanText);
-    SKSE::log::info("BookUtils: NeedsSanitization={}",
-                    needsSanitization ? "true" : "false");
-    cleanText = sanitizer->Sanitize(cleanText);
+  std::uint64_t fingerprint = HashText(source.title);
+  if (!resolved.empty()) {
+    fingerprint = HashCombine(fingerprint, HashText(resolved));
   }
+  fingerprint = HashCombine(
+      fingerprint, (static_cast<std::uint64_t>(sanitizer->IsEnabled()) << 8) |
+                       static_cast<std::uint64_t>(sanitizer->GetMode()));
+  source.key = BookCache::Key{book->GetFormID(), fingerprint};
 
-  return cleanText;
-}
-
-std::string BookUtils::StripMarkup(const std::string &text) {
-  std::string result;
-  result.reserve(text.size());
-
-  bool inTag = false;
-  bool inEntity = false;
-  std::string entityBuffer;
-
-  for (size_t i = 0; i < text.size(); ++i) {
-    char c = text[i];
-
-    if (inEntity) {
-      entityBuffer += c;
-      if (c == ';') {
-        // Resolve common HTML entities
-        if (entityBuffer == "&nbsp;") {
-          result += ' ';
-        } else if (entityBuffer == "&lt;") {
-          result += '<';
-        } else if (entityBuffer == "&gt;") {
-          result += '>';
-        } else if (entityBuffer == "&amp;") {
-          result += '&';
-        } else if (entityBuffer == "&quot;") {
-          result += '"';
-        } else if (entityBuffer == "&apos;") {
-          result += '\'';
-        } else if (entityBuffer == "&#10;" || entityBuffer == "&#13;") {
-          result += '\n';
-        } else {
-          // Unknown entity, just skip it
-        }
-        inEntity = false;
-        entityBuffer.clear();
-      }
-      continue;
-    }
-
-    if (c == '&') {
-      inEntity = true;
-      entityBuffer = "&";
-      continue;
-    }
-
-    if (c == '<') {
-      // Check for img tag
-      if (i + 4 < text.size()) {
-        std::string tagCheck = text.substr(i, 4);
-        if (tagCheck == "<img" || tagCheck == "<IMG") {
-          // Find the end of the tag
-          size_t tagEnd = text.find('>', i);
-          if (tagEnd != std::string::npos) {
-            // Extract the full tag
-            std::string fullTag = text.substr(i, tagEnd - i + 1);
-
-            // Find src attribute
-            size_t srcPos = fullTag.find("src=");
-            if (srcPos == std::string::npos) {
-              srcPos = fullTag.find("SRC=");
-            }
-
-            if (srcPos != std::string::npos) {
-              // Find the quote after src=
-              size_t quoteStart = fullTag.find_first_of("'\"", srcPos);
-              if (quoteStart != std::string::npos) {
-                char quoteChar = fullTag[quoteStart];
-                size_t quoteEnd = fullTag.find(quoteChar, quoteStart + 1);
-                if (quoteEnd != std::string::npos) {
-                  std::string srcValue =
-                      fullTag.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-
-                  // Remove img:// prefix if present
-                  if (srcValue.substr(0, 6) == "img://") {
-                    srcValue = srcValue.substr(6);
-                  }
-
-                  // Look up replacement
-                  auto *imageMappings = ImageMappings::GetSingleton();
-                  std::string replacement =
-                      imageMappings->GetReplacement(srcValue);
-
-                  if (!replacement.empty()) {
-                    result += replacement;
-                  }
-                  // If no mapping, the image is just removed (no output)
-                }
-              }
-            }
-
-            // Skip past the entire img tag
-            i = tagEnd;
-            continue;
-          }
-        }
-      }
-
-      // Check for special tags that should become newlines
-      if (i + 3 < text.size()) {
-        std::string tagStart = text.substr(i, 4);
-        if (tagStart == "<br>" || tagStart == "<BR>" || tagStart == "<br/" ||
-            tagStart == "<BR/") {
-          result += '\n';
-        }
-        // Check for </p> or </P> - paragraph end
-        if (i + 3 < text.size() &&
-            (text.substr(i, 4) == "</p>" || text.substr(i, 4) == "</P>")) {
-          result += "\n\n";
-        }
-      }
-      inTag = true;
-      continue;
-    }
-
-    if (c == '>') {
-      inTag = false;
-      continue;
-    }
-
-    if (!inTag) {
-      result += c;
-    }
+  if (resolved.empty()) {
+    source.raw.assign(rawText);
+  } else {
+    source.raw = std::move(resolved);
   }
-
-  return result;
+  return source;
 }
 
-std::string BookUtils::NormalizeWhitespace(const std::string &text) {
-  std::string result;
-  result.reserve(text.size());
-
-  bool lastWasSpace = false;
-  bool lastWasNewline = false;
-  int consecutiveNewlines = 0;
-
-  for (char c : text) {
-    if (c == '\n' || c == '\r') {
-      if (!lastWasNewline) {
-        consecutiveNewlines = 1;
-        lastWasNewline = true;
-      } else if (consecutiveNewlines < 2) {
-        consecutiveNewlines++;
-      }
-      lastWasSpace = false;
-      continue;
-    }
-
-    // Flush pending newlines
-    if (lastWasNewline) {
-      for (int i = 0; i < consecutiveNewlines; ++i) {
-        result += '\n';
-      }
-      lastWasNewline = false;
-      consecutiveNewlines = 0;
-    }
-
-    if (c == ' ' || c == '\t') {
-      if (!lastWasSpace && !result.empty()) {
-        result += ' ';
-        lastWasSpace = true;
-      }
-    } else {
-      result += c;
-      lastWasSpace = false;
-    }
-  }
+} // namespace
 
-  // Trim leading whitespace
-  size_t start = 0;
-  while (start < result.size() &&
-         (result[start] == ' ' || result[start] == '\n' ||
-          result[start] == '\r' || result[start] == '\t')) {
-    start++;
-  }
-  if (start > 0) {
-    result = result.substr(start);
-  }
-
-  // Trim trailing whitespace
-  while (!result.empty() && (result.back() == ' ' || result.back() == '\n')) {
-    result.pop_back();
+std::string BookUtils::GetBookTitle(RE::TESObjectBOOK *book) {
+  if (!book) {
+    return "";
   }
 
-  return result;
-}
-
-std::string BookUtils::StripPagebreaks(const std::string &text) {
-  std::string result = text;
+  const char *name = book->GetName();
+  std::string title = name ? name : "";
 
-  // Remove [pagebreak] markers (case insensitive)
-  const std::string pagebreakLower = "[pagebreak]";
-  const std::string pagebreakUpper = "[PAGEBREAK]";
-  const std::string pagebreakMixed = "[Pagebreak]";
+  auto *aliasResolver = AliasResolver::GetSingleton();
+  title = aliasResolver->ResolveAliases(title, book);
 
-  size_t pos;
-  while ((pos = result.find(pagebreakLower)) != std::string::npos) {
-    result.erase(pos, pagebreakLower.length());
-  }
-  while ((pos = result.find(pagebreakUpper)) != std::string::npos) {
-    result.erase(pos, pagebreakUpper.length());
-  }
-  while ((pos = result.find(pagebreakMixed)) != std::string::npos) {
-    result.erase(pos, pagebreakMixed.length());
+  // Apply text sanitization to title
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  if (sanitizer->IsEnabled()) {
+    title = sanitizer->Sanitize(title);
   }
 
-  return result;
+  return title;
 }
 
-bool BookUtils::IsNote(RE::TESObjectBOOK *book) {
+std::optional<BookUtils::BookSource>
+BookUtils::ReadBookSource(RE::TESObjectBOOK *book) {
   if (!book) {
-    return false;
+    return std::nullopt;
   }
 
-  // Notes have the kNote flag set in their data
-  return book->IsNote();
+  RE::BSString description;
+  std::string resolved;
+  const std::string_view rawText = GetRawText(book, description, resolved);
+  return MakeSource(book, rawText, std::move(resolved));
 }
 
-std::string BookUtils::RemoveDuplicateTitle(const std::string &text,
-                                            const std::string &title) {
-  if (title.empty() || text.empty()) {
-    return text;
+std::optional<BookUtils::BookSource>
+BookUtils::ReadStaticBookSource(RE::TESObjectBOOK *book) {
+  if (!book) {
+    return std::nullopt;
   }
 
-  // Find the first line of the body text
-  size_t firstNewline = text.find('\n');
-  std::string firstLine;
-  if (firstNewline != std::string::npos) {
-    firstLine = text.substr(0, firstNewline);
-  } else {
-    firstLine = text;
+  const char *name = book->GetName();
+  if (name && HasAliases(name)) {
+    return std::nullopt;
   }
 
-  // Trim whitespace from first line for comparison
-  size_t start = firstLine.find_first_not_of(" \t\r\n");
-  size_t end = firstLine.find_last_not_of(" \t\r\n");
-  if (start != std::string::npos && end != std::string::npos) {
-    firstLine = firstLine.substr(start, end - start + 1);
+  RE::BSString description;
+  book->GetDescription(description, nullptr);
+  const std::string_view rawText(description.c_str(), description.length());
+  if (HasAliases(rawText)) {
+    return std::nullopt;
   }
+  return MakeSource(book, rawText, {});
+}
 
-  // Trim whitespace from title for comparison
-  std::string trimmedTitle = title;
-  start = trimmedTitle.find_first_not_of(" \t\r\n");
-  end = trimmedTitle.find_last_not_of(" \t\r\n");
-  if (start != std::string::npos && end != std::string::npos) {
-    trimmedTitle = trimmedTitle.substr(start, end - start + 1);
+std::shared_ptr<const BookDocument>
+BookUtils::FindDocument(const BookCache::Key &key) {
+  auto *cache = BookCache::GetSingleton();
+  if (auto cached = cache->Find(key)) {
+    return cached;
   }
-
-  // Case-insensitive comparison
-  auto toLower = [](std::string s) {
-    for (char &c : s) {
-      if (c >= 'A' && c <= 'Z') {
-        c = c - 'A' + 'a';
-      }
-    }
-    return s;
-  };
-
-  if (toLower(firstLine) == toLower(trimmedTitle)) {
-    // Remove the first line (including the newline)
-    if (firstNewline != std::string::npos) {
-      std::string result = text.substr(firstNewline + 1);
-      // Trim leading whitespace from result
-      size_t resultStart = result.find_first_not_of(" \t\r\n");
-      if (resultStart != std::string::npos && resultStart > 0) {
-        result = result.substr(resultStart);
-      }
-      SKSE::log::debug("BookUtils: Removed duplicate title from body");
-      return result;
-    }
-    // The entire text was just the title
-    return "";
+  // Unpacked from the library once, then read from the cache like any other
+  if (auto prepared = BookLibrary::GetSingleton()->Find(key)) {
+    cache->Insert(key, prepared);
+    return prepared;
   }
+  return nullptr;
+}
 
-  return text;
+std::shared_ptr<const BookDocument>
+BookUtils::BuildDocument(const BookSource &source) {
+  auto document = std::make_shared<BookDocument>();
+  ParseDocument(source, *document);
+
+  SKSE::log::debug("BookUtils: Document: {} bytes, {} spans, {} paragraphs, "
+                   "{} styles",
+                   document->text.size(), document->spans.size(),
+                   document->paragraphs.size(), document->styles.size());
+  BookCache::GetSingleton()->Insert(source.key, document);
+  return document;
 }
 
-std::string BookUtils::CleanByPattern(const std::string &text) {
-  std::string result = text;
+void BookUtils::ParseDocument(const BookSource &source,
+                              BookDocument &document) {
+  document.title = source.title;
+  BookPipeline::Process(source.raw, MakeOptions(document.title), document);
+}
 
-  // Pattern: "\n\nby\n\n" or at start "by\n\n"
-  // We want to remove the surrounding blank lines, keeping just "by\n"
+BookPipeline::Options BookUtils::MakeOptions(std::string_view title) {
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  SKSE::log::debug("BookUtils: Sanitizer enabled={}, mode={}",
+                  sanitizer->IsEnabled() ? "true" : "false",
+                  static_cast<int>(sanitizer->GetMode()));
 
-  // Handle pattern in middle of text: "\n\nby\n\n" -> "\nby\n"
-  const std::string pattern1 = "\n\nby\n\n";
-  const std::string replacement1 = "\nby\n";
-  size_t pos;
-  while ((pos = result.find(pattern1)) != std::string::npos) {
-    result.replace(pos, pattern1.length(), replacement1);
-    SKSE::log::debug("BookUtils: Cleaned 'by' pattern (middle)");
-  }
+  BookPipeline::Options options;
+  options.title = title;
+  options.imageLookup = &LookupImage;
+  options.sanitizer = sanitizer->IsEnabled() ? sanitizer : nullptr;
+  return options;
+}
 
-  // Handle pattern at start: "by\n\n" when it's the first line
-  if (result.length() >= 4 && result.substr(0, 4) == "by\n\n") {
-    result = "by\n" + result.substr(4);
-    SKSE::log::debug("BookUtils: Cleaned 'by' pattern (start)");
-  }
+std::string BookUtils::StripMarkup(const std::string &text) {
+  return BookPipeline::StripMarkup(text, &LookupImage);
+}
 
-  // Handle case-insensitive "By" as well
-  const std::string pattern2 = "\n\nBy\n\n";
-  while ((pos = result.find(pattern2)) != std::string::npos) {
-    result.replace(pos, pattern2.length(), "\nBy\n");
-    SKSE::log::debug("BookUtils: Cleaned 'By' pattern (middle)");
-  }
+std::string_view BookUtils::LookupImage(std::string_view imagePath) {
+  return ImageMappings::GetSingleton()->GetReplacement(imagePath);
+}
 
-  if (result.length() >= 4 && result.substr(0, 4) == "By\n\n") {
-    result = "By\n" + result.substr(4);
-    SKSE::log::debug("BookUtils: Cleaned 'By' pattern (start)");
+bool BookUtils::IsNote(RE::TESObjectBOOK *book) {
+  if (!book) {
+    return false;
   }
 
-  return result;
+  // Notes have the kNote flag set in their data
+  return book->IsNote();
 }
 
 } // namespace Easy2Read
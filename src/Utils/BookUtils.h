@@ -1,6 +1,11 @@
 #pragma once
 
+#include "BookCache.h"
+#include "BookPipeline.h"
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace RE {
 class TESObjectBOOK;
@@ -8,13 +13,38 @@ class TESObjectBOOK;
 
 namespace Easy2Read {
 
+struct BookDocument;
+
 class BookUtils {
 public:
+  // Everything the pipeline needs from a book, copied on the game thread
+  struct BookSource {
+    std::string raw;   // Description with aliases resolved
+    std::string title; // Resolved, sanitized title
+    BookCache::Key key;
+  };
+
   // Extract book title
   static std::string GetBookTitle(RE::TESObjectBOOK *book);
 
-  // Extract book text content, with markup stripped
-  static std::string GetBookText(RE::TESObjectBOOK *book);
+  // Read a book's text, title and cache key (game thread: touches forms)
+  static std::optional<BookSource> ReadBookSource(RE::TESObjectBOOK *book);
+
+  // Same, without resolving aliases: books whose text or title uses quest
+  // aliases are skipped (game thread)
+  static std::optional<BookSource>
+  ReadStaticBookSource(RE::TESObjectBOOK *book);
+
+  // Document from the BookCache or the BookLibrary, or null (any thread)
+  static std::shared_ptr<const BookDocument>
+  FindDocument(const BookCache::Key &key);
+
+  // Run the pipeline on a source and cache the result (any thread)
+  static std::shared_ptr<const BookDocument>
+  BuildDocument(const BookSource &source);
+
+  // Run the pipeline on a source into a caller-owned document (any thread)
+  static void ParseDocument(const BookSource &source, BookDocument &document);
 
   // Strip Scaleform/HTML-like tags from text
   static std::string StripMarkup(const std::string &text);
@@ -23,18 +53,11 @@ public:
   static bool IsNote(RE::TESObjectBOOK *book);
 
 private:
-  // Internal helper to clean up whitespace
-  static std::string NormalizeWhitespace(const std::string &text);
-
-  // Strip [pagebreak] markers
-  static std::string StripPagebreaks(const std::string &text);
-
-  // Remove first line if it matches the title (case-insensitive)
-  static std::string RemoveDuplicateTitle(const std::string &text,
-                                          const std::string &title);
+  // Pipeline options for a book: title, image mappings and sanitizer
+  static BookPipeline::Options MakeOptions(std::string_view title);
 
-  // Remove blank lines around standalone "by" line
-  static std::string CleanByPattern(const std::string &text);
+  // Image mapping lookup handed to the BookPipeline
+  static std::string_view LookupImage(std::string_view imagePath);
 };
 
 } // namespace Easy2Read
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Easy2Read {
+
+/**
+ * 64-bit avalanche finalizer (MurmurHash3 fmix64): every input bit affects
+ * every output bit, so packed integer keys can be masked into table indices.
+ */
+[[nodiscard]] constexpr std::uint64_t HashInt(std::uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDull;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * Fast non-cryptographic 64-bit hash for text content.
+ * Consumes 8 bytes per step and finishes with a strong avalanche mix, so it is
+ * suitable both for hash-table keys and for "did this text change" checks.
+ */
+[[nodiscard]] inline std::uint64_t HashText(std::string_view text,
+                                            std::uint64_t seed = 0) {
+  constexpr std::uint64_t kMul = 0x9E3779B97F4A7C15ull;
+
+  std::uint64_t h = seed ^ (static_cast<std::uint64_t>(text.size()) * kMul);
+  const char *p = text.data();
+  std::size_t remaining = text.size();
+
+  while (remaining >= 8) {
+    std::uint64_t word;
+    std::memcpy(&word, p, 8);
+    h = (h ^ HashInt(word)) * kMul;
+    p += 8;
+    remaining -= 8;
+  }
+
+  if (remaining > 0) {
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, p, remaining);
+    h = (h ^ HashInt(tail)) * kMul;
+  }
+
+  return HashInt(h);
+}
+
+/**
+ * Combine two hash values (order-dependent).
+ */
+[[nodiscard]] constexpr std::uint64_t HashCombine(std::uint64_t a_seed,
+                                                  std::uint64_t a_value) {
+  return a_seed ^
+         (a_value + 0x9E3779B97F4A7C15ull + (a_seed << 6) + (a_seed >> 2));
+}
+
+} // namespace Easy2Read
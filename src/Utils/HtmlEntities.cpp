@@ -0,0 +1,2325 @@
+#include "HtmlEntities.h"
+#include "PCH.h"
+#include <array>
+
+namespace Easy2Read {
+
+namespace {
+
+struct NamedEntity {
+  std::string_view name; // Without '&' and ';'
+  char32_t codepoints[2];
+};
+
+constexpr std::size_t kEntityCount = 2125;
+constexpr std::size_t kBucketCount = 512;
+constexpr std::size_t kMaxNameLength = 32; // "CounterClockwiseContourIntegral"
+
+// FNV-1a, seeded for the two hash levels
+constexpr std::uint32_t HashName(std::string_view name, std::uint32_t seed) {
+  std::uint32_t hash = 2166136261u ^ seed;
+  for (const char c : name) {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Named references in perfect-hash slot order. Generated from the WHATWG
+// HTML5 named character reference list (2125 names); kDisplacement and
+// this table must be regenerated together.
+constexpr std::array<NamedEntity, kEntityCount> kEntities = {{
+    {"RightArrowBar", {0x21E5}},
+    {"gtlPar", {0x2995}},
+    {"spadesuit", {0x2660}},
+    {"sccue", {0x227D}},
+    {"dot", {0x2D9}},
+    {"Uarrocir", {0x2949}},
+    {"triangledown", {0x25BF}},
+    {"plus", {0x2B}},
+    {"rharu", {0x21C0}},
+    {"rotimes", {0x2A35}},
+    {"disin", {0x22F2}},
+    {"NegativeThinSpace", {0x200B}},
+    {"cong", {0x2245}},
+    {"hardcy", {0x44A}},
+    {"Aacute", {0xC1}},
+    {"Longleftarrow", {0x27F8}},
+    {"Cayleys", {0x212D}},
+    {"lat", {0x2AAB}},
+    {"it", {0x2062}},
+    {"fllig", {0xFB02}},
+    {"ugrave", {0xF9}},
+    {"gesles", {0x2A94}},
+    {"duarr", {0x21F5}},
+    {"Uring", {0x16E}},
+    {"models", {0x22A7}},
+    {"dzcy", {0x45F}},
+    {"nvlArr", {0x2902}},
+    {"ubreve", {0x16D}},
+    {"Zcy", {0x417}},
+    {"RightTeeVector", {0x295B}},
+    {"dd", {0x2146}},
+    {"mu", {0x3BC}},
+    {"Rcedil", {0x156}},
+    {"timesbar", {0x2A31}},
+    {"ldca", {0x2936}},
+    {"eta", {0x3B7}},
+    {"DoubleRightTee", {0x22A8}},
+    {"erDot", {0x2253}},
+    {"NotVerticalBar", {0x2224}},
+    {"xodot", {0x2A00}},
+    {"Gfr", {0x1D50A}},
+    {"sqcups", {0x2294, 0xFE00}},
+    {"Hacek", {0x2C7}},
+    {"lrcorner", {0x231F}},
+    {"Bscr", {0x212C}},
+    {"malt", {0x2720}},
+    {"boxvr", {0x251C}},
+    {"hybull", {0x2043}},
+    {"Or", {0x2A54}},
+    {"subsup", {0x2AD3}},
+    {"TScy", {0x426}},
+    {"Idot", {0x130}},
+    {"omid", {0x29B6}},
+    {"iiota", {0x2129}},
+    {"UpTee", {0x22A5}},
+    {"rbarr", {0x290D}},
+    {"siml", {0x2A9D}},
+    {"nVDash", {0x22AF}},
+    {"radic", {0x221A}},
+    {"DoubleLeftArrow", {0x21D0}},
+    {"gcirc", {0x11D}},
+    {"Ccedil", {0xC7}},
+    {"Scedil", {0x15E}},
+    {"MediumSpace", {0x205F}},
+    {"Del", {0x2207}},
+    {"epsilon", {0x3B5}},
+    {"acy", {0x430}},
+    {"FilledSmallSquare", {0x25FC}},
+    {"Ncaron", {0x147}},
+    {"NotSubset", {0x2282, 0x20D2}},
+    {"NotGreaterFullEqual", {0x2267, 0x338}},
+    {"Conint", {0x222F}},
+    {"swarhk", {0x2926}},
+    {"ncaron", {0x148}},
+    {"SucceedsSlantEqual", {0x227D}},
+    {"target", {0x2316}},
+    {"gsim", {0x2273}},
+    {"angst", {0xC5}},
+    {"rtriltri", {0x29CE}},
+    {"half", {0xBD}},
+    {"Sub", {0x22D0}},
+    {"imof", {0x22B7}},
+    {"bcong", {0x224C}},
+    {"DownBreve", {0x311}},
+    {"thksim", {0x223C}},
+    {"lambda", {0x3BB}},
+    {"DoubleDownArrow", {0x21D3}},
+    {"Acy", {0x410}},
+    {"DiacriticalAcute", {0xB4}},
+    {"scpolint", {0x2A13}},
+    {"yopf", {0x1D56A}},
+    {"trianglelefteq", {0x22B4}},
+    {"sopf", {0x1D564}},
+    {"xmap", {0x27FC}},
+    {"seArr", {0x21D8}},
+    {"puncsp", {0x2008}},
+    {"bumpe", {0x224F}},
+    {"inodot", {0x131}},
+    {"isindot", {0x22F5}},
+    {"preceq", {0x2AAF}},
+    {"Amacr", {0x100}},
+    {"gtcc", {0x2AA7}},
+    {"ApplyFunction", {0x2061}},
+    {"AMP", {0x26}},
+    {"angsph", {0x2222}},
+    {"LeftRightArrow", {0x2194}},
+    {"trie", {0x225C}},
+    {"ohm", {0x3A9}},
+    {"prod", {0x220F}},
+    {"lmoust", {0x23B0}},
+    {"bigoplus", {0x2A01}},
+    {"NotSuperset", {0x2283, 0x20D2}},
+    {"Superset", {0x2283}},
+    {"fltns", {0x25B1}},
+    {"drcorn", {0x231F}},
+    {"Uarr", {0x219F}},
+    {"sqsupe", {0x2292}},
+    {"para", {0xB6}},
+    {"Cconint", {0x2230}},
+    {"gtcir", {0x2A7A}},
+    {"nleftrightarrow", {0x21AE}},
+    {"Hcirc", {0x124}},
+    {"times", {0xD7}},
+    {"boxHd", {0x2564}},
+    {"Iota", {0x399}},
+    {"jopf", {0x1D55B}},
+    {"LeftDownVector", {0x21C3}},
+    {"VeryThinSpace", {0x200A}},
+    {"ohbar", {0x29B5}},
+    {"SquareIntersection", {0x2293}},
+    {"hkswarow", {0x2926}},
+    {"isinsv", {0x22F3}},
+    {"Upsilon", {0x3A5}},
+    {"ordm", {0xBA}},
+    {"DownArrow", {0x2193}},
+    {"geqslant", {0x2A7E}},
+    {"LongLeftArrow", {0x27F5}},
+    {"Downarrow", {0x21D3}},
+    {"topfork", {0x2ADA}},
+    {"varpropto", {0x221D}},
+    {"frac13", {0x2153}},
+    {"parsl", {0x2AFD}},
+    {"Jfr", {0x1D50D}},
+    {"andslope", {0x2A58}},
+    {"nrArr", {0x21CF}},
+    {"ccupssm", {0x2A50}},
+    {"pfr", {0x1D52D}},
+    {"Zcaron", {0x17D}},
+    {"ncup", {0x2A42}},
+    {"leftharpoondown", {0x21BD}},
+    {"bigwedge", {0x22C0}},
+    {"topf", {0x1D565}},
+    {"doublebarwedge", {0x2306}},
+    {"ifr", {0x1D526}},
+    {"UpTeeArrow", {0x21A5}},
+    {"sc", {0x227B}},
+    {"fork", {0x22D4}},
+    {"oacute", {0xF3}},
+    {"nedot", {0x2250, 0x338}},
+    {"ldquor", {0x201E}},
+    {"nprec", {0x2280}},
+    {"boxvH", {0x256A}},
+    {"solbar", {0x233F}},
+    {"ngE", {0x2267, 0x338}},
+    {"GreaterTilde", {0x2273}},
+    {"Ropf", {0x211D}},
+    {"blk34", {0x2593}},
+    {"rarrap", {0x2975}},
+    {"scirc", {0x15D}},
+    {"VerticalSeparator", {0x2758}},
+    {"weierp", {0x2118}},
+    {"rightleftarrows", {0x21C4}},
+    {"excl", {0x21}},
+    {"lrhard", {0x296D}},
+    {"zfr", {0x1D537}},
+    {"boxbox", {0x29C9}},
+    {"suphsub", {0x2AD7}},
+    {"edot", {0x117}},
+    {"Eacute", {0xC9}},
+    {"smeparsl", {0x29E4}},
+    {"phone", {0x260E}},
+    {"jmath", {0x237}},
+    {"NotSquareSubsetEqual", {0x22E2}},
+    {"lnsim", {0x22E6}},
+    {"supmult", {0x2AC2}},
+    {"late", {0x2AAD}},
+    {"Wopf", {0x1D54E}},
+    {"Epsilon", {0x395}},
+    {"racute", {0x155}},
+    {"RightDownVectorBar", {0x2955}},
+    {"erarr", {0x2971}},
+    {"Vert", {0x2016}},
+    {"nharr", {0x21AE}},
+    {"thkap", {0x2248}},
+    {"curlyvee", {0x22CE}},
+    {"varsigma", {0x3C2}},
+    {"rcedil", {0x157}},
+    {"LeftTeeVector", {0x295A}},
+    {"Jcy", {0x419}},
+    {"zcy", {0x437}},
+    {"NotGreaterTilde", {0x2275}},
+    {"NestedLessLess", {0x226A}},
+    {"cuvee", {0x22CE}},
+    {"xhArr", {0x27FA}},
+    {"RightTriangle", {0x22B3}},
+    {"ntrianglerighteq", {0x22ED}},
+    {"natural", {0x266E}},
+    {"NotLessSlantEqual", {0x2A7D, 0x338}},
+    {"Bernoullis", {0x212C}},
+    {"scsim", {0x227F}},
+    {"nwarr", {0x2196}},
+    {"mid", {0x2223}},
+    {"lneq", {0x2A87}},
+    {"gscr", {0x210A}},
+    {"napE", {0x2A70, 0x338}},
+    {"boxDL", {0x2557}},
+    {"hearts", {0x2665}},
+    {"gneq", {0x2A88}},
+    {"Star", {0x22C6}},
+    {"notindot", {0x22F5, 0x338}},
+    {"percnt", {0x25}},
+    {"Rcy", {0x420}},
+    {"twoheadleftarrow", {0x219E}},
+    {"cup", {0x222A}},
+    {"urtri", {0x25F9}},
+    {"wreath", {0x2240}},
+    {"Lcedil", {0x13B}},
+    {"leftrightharpoons", {0x21CB}},
+    {"conint", {0x222E}},
+    {"eng", {0x14B}},
+    {"frown", {0x2322}},
+    {"checkmark", {0x2713}},
+    {"RightTeeArrow", {0x21A6}},
+    {"nvltrie", {0x22B4, 0x20D2}},
+    {"cirfnint", {0x2A10}},
+    {"NotLeftTriangleBar", {0x29CF, 0x338}},
+    {"nvlt", {0x3C, 0x20D2}},
+    {"subplus", {0x2ABF}},
+    {"xuplus", {0x2A04}},
+    {"boxhu", {0x2534}},
+    {"scedil", {0x15F}},
+    {"lnap", {0x2A89}},
+    {"boxDr", {0x2553}},
+    {"downdownarrows", {0x21CA}},
+    {"nltri", {0x22EA}},
+    {"supE", {0x2AC6}},
+    {"bigcap", {0x22C2}},
+    {"angmsdac", {0x29AA}},
+    {"swarr", {0x2199}},
+    {"nsucc", {0x2281}},
+    {"trpezium", {0x23E2}},
+    {"Yopf", {0x1D550}},
+    {"jcy", {0x439}},
+    {"langd", {0x2991}},
+    {"Ufr", {0x1D518}},
+    {"not", {0xAC}},
+    {"lcaron", {0x13E}},
+    {"yen", {0xA5}},
+    {"bump", {0x224E}},
+    {"nexists", {0x2204}},
+    {"nopf", {0x1D55F}},
+    {"rHar", {0x2964}},
+    {"VerticalLine", {0x7C}},
+    {"AElig", {0xC6}},
+    {"lbbrk", {0x2772}},
+    {"Ograve", {0xD2}},
+    {"eDot", {0x2251}},
+    {"rangd", {0x2992}},
+    {"DownRightVector", {0x21C1}},
+    {"sfrown", {0x2322}},
+    {"shortparallel", {0x2225}},
+    {"HumpEqual", {0x224F}},
+    {"circledS", {0x24C8}},
+    {"cuesc", {0x22DF}},
+    {"dcy", {0x434}},
+    {"Subset", {0x22D0}},
+    {"nvle", {0x2264, 0x20D2}},
+    {"NotHumpEqual", {0x224F, 0x338}},
+    {"rightarrow", {0x2192}},
+    {"sqsubseteq", {0x2291}},
+    {"nldr", {0x2025}},
+    {"ZHcy", {0x416}},
+    {"NonBreakingSpace", {0xA0}},
+    {"ulcrop", {0x230F}},
+    {"integers", {0x2124}},
+    {"Odblac", {0x150}},
+    {"SquareSubsetEqual", {0x2291}},
+    {"iscr", {0x1D4BE}},
+    {"nLeftrightarrow", {0x21CE}},
+    {"GT", {0x3E}},
+    {"iacute", {0xED}},
+    {"NotRightTriangleEqual", {0x22ED}},
+    {"CirclePlus", {0x2295}},
+    {"gimel", {0x2137}},
+    {"part", {0x2202}},
+    {"delta", {0x3B4}},
+    {"rangle", {0x27E9}},
+    {"ulcorner", {0x231C}},
+    {"ccaps", {0x2A4D}},
+    {"ZeroWidthSpace", {0x200B}},
+    {"lsimg", {0x2A8F}},
+    {"odiv", {0x2A38}},
+    {"rmoust", {0x23B1}},
+    {"sect", {0xA7}},
+    {"Bfr", {0x1D505}},
+    {"verbar", {0x7C}},
+    {"kscr", {0x1D4C0}},
+    {"uscr", {0x1D4CA}},
+    {"oscr", {0x2134}},
+    {"period", {0x2E}},
+    {"image", {0x2111}},
+    {"fpartint", {0x2A0D}},
+    {"YUcy", {0x42E}},
+    {"Dscr", {0x1D49F}},
+    {"lrhar", {0x21CB}},
+    {"uuarr", {0x21C8}},
+    {"Yscr", {0x1D4B4}},
+    {"nsimeq", {0x2244}},
+    {"rdquor", {0x201D}},
+    {"sacute", {0x15B}},
+    {"ange", {0x29A4}},
+    {"boxvh", {0x253C}},
+    {"tcy", {0x442}},
+    {"acE", {0x223E, 0x333}},
+    {"rho", {0x3C1}},
+    {"olarr", {0x21BA}},
+    {"angmsd", {0x2221}},
+    {"Iogon", {0x12E}},
+    {"els", {0x2A95}},
+    {"caron", {0x2C7}},
+    {"Ofr", {0x1D512}},
+    {"angmsdad", {0x29AB}},
+    {"dharr", {0x21C2}},
+    {"lscr", {0x1D4C1}},
+    {"lowast", {0x2217}},
+    {"olcir", {0x29BE}},
+    {"gcy", {0x433}},
+    {"rightthreetimes", {0x22CC}},
+    {"ratail", {0x291A}},
+    {"Rang", {0x27EB}},
+    {"Euml", {0xCB}},
+    {"pertenk", {0x2031}},
+    {"dbkarow", {0x290F}},
+    {"hyphen", {0x2010}},
+    {"scaron", {0x161}},
+    {"congdot", {0x2A6D}},
+    {"leg", {0x22DA}},
+    {"Ecaron", {0x11A}},
+    {"diamond", {0x22C4}},
+    {"PrecedesTilde", {0x227E}},
+    {"rAtail", {0x291C}},
+    {"plusmn", {0xB1}},
+    {"ogon", {0x2DB}},
+    {"asympeq", {0x224D}},
+    {"uArr", {0x21D1}},
+    {"doteq", {0x2250}},
+    {"Ubreve", {0x16C}},
+    {"boxvR", {0x255E}},
+    {"vrtri", {0x22B3}},
+    {"blacktriangleleft", {0x25C2}},
+    {"boxUR", {0x255A}},
+    {"ExponentialE", {0x2147}},
+    {"plustwo", {0x2A27}},
+    {"oline", {0x203E}},
+    {"csupe", {0x2AD2}},
+    {"naturals", {0x2115}},
+    {"ReverseUpEquilibrium", {0x296F}},
+    {"alpha", {0x3B1}},
+    {"lgE", {0x2A91}},
+    {"nles", {0x2A7D, 0x338}},
+    {"TripleDot", {0x20DB}},
+    {"lstrok", {0x142}},
+    {"GreaterSlantEqual", {0x2A7E}},
+    {"curlyeqsucc", {0x22DF}},
+    {"RightDownTeeVector", {0x295D}},
+    {"cupdot", {0x228D}},
+    {"lparlt", {0x2993}},
+    {"capbrcup", {0x2A49}},
+    {"sum", {0x2211}},
+    {"PrecedesEqual", {0x2AAF}},
+    {"Gcy", {0x413}},
+    {"Jukcy", {0x404}},
+    {"NewLine", {0xA}},
+    {"nspar", {0x2226}},
+    {"zwnj", {0x200C}},
+    {"piv", {0x3D6}},
+    {"beth", {0x2136}},
+    {"RightArrowLeftArrow", {0x21C4}},
+    {"npart", {0x2202, 0x338}},
+    {"twixt", {0x226C}},
+    {"Eogon", {0x118}},
+    {"Sopf", {0x1D54A}},
+    {"kappa", {0x3BA}},
+    {"DScy", {0x405}},
+    {"tfr", {0x1D531}},
+    {"rightsquigarrow", {0x219D}},
+    {"rtimes", {0x22CA}},
+    {"barvee", {0x22BD}},
+    {"nsc", {0x2281}},
+    {"rightarrowtail", {0x21A3}},
+    {"pre", {0x2AAF}},
+    {"boxVL", {0x2563}},
+    {"gg", {0x226B}},
+    {"ee", {0x2147}},
+    {"boxtimes", {0x22A0}},
+    {"ccirc", {0x109}},
+    {"dlcorn", {0x231E}},
+    {"numero", {0x2116}},
+    {"ap", {0x2248}},
+    {"CounterClockwiseContourIntegral", {0x2233}},
+    {"LowerLeftArrow", {0x2199}},
+    {"yscr", {0x1D4CE}},
+    {"LeftUpDownVector", {0x2951}},
+    {"gammad", {0x3DD}},
+    {"xcup", {0x22C3}},
+    {"lbrksld", {0x298F}},
+    {"capcap", {0x2A4B}},
+    {"lnE", {0x2268}},
+    {"kcy", {0x43A}},
+    {"Ouml", {0xD6}},
+    {"middot", {0xB7}},
+    {"crarr", {0x21B5}},
+    {"ShortUpArrow", {0x2191}},
+    {"downarrow", {0x2193}},
+    {"supseteq", {0x2287}},
+    {"rarrhk", {0x21AA}},
+    {"nltrie", {0x22EC}},
+    {"SucceedsEqual", {0x2AB0}},
+    {"cupcup", {0x2A4A}},
+    {"EmptyVerySmallSquare", {0x25AB}},
+    {"boxur", {0x2514}},
+    {"ocy", {0x43E}},
+    {"angmsdaa", {0x29A8}},
+    {"Barv", {0x2AE7}},
+    {"rx", {0x211E}},
+    {"quest", {0x3F}},
+    {"sime", {0x2243}},
+    {"Sup", {0x22D1}},
+    {"pscr", {0x1D4C5}},
+    {"mcy", {0x43C}},
+    {"nwArr", {0x21D6}},
+    {"blacklozenge", {0x29EB}},
+    {"gamma", {0x3B3}},
+    {"CloseCurlyQuote", {0x2019}},
+    {"hairsp", {0x200A}},
+    {"intlarhk", {0x2A17}},
+    {"horbar", {0x2015}},
+    {"mfr", {0x1D52A}},
+    {"xvee", {0x22C1}},
+    {"lescc", {0x2AA8}},
+    {"OverBar", {0x203E}},
+    {"LeftCeiling", {0x2308}},
+    {"TildeFullEqual", {0x2245}},
+    {"map", {0x21A6}},
+    {"Vvdash", {0x22AA}},
+    {"xrarr", {0x27F6}},
+    {"lArr", {0x21D0}},
+    {"imped", {0x1B5}},
+    {"lmidot", {0x140}},
+    {"nsubseteq", {0x2288}},
+    {"Aring", {0xC5}},
+    {"RightUpVector", {0x21BE}},
+    {"succnapprox", {0x2ABA}},
+    {"amalg", {0x2A3F}},
+    {"profsurf", {0x2313}},
+    {"Nopf", {0x2115}},
+    {"Oslash", {0xD8}},
+    {"Otilde", {0xD5}},
+    {"nLl", {0x22D8, 0x338}},
+    {"subrarr", {0x2979}},
+    {"gtrapprox", {0x2A86}},
+    {"operp", {0x29B9}},
+    {"QUOT", {0x22}},
+    {"varnothing", {0x2205}},
+    {"lesdoto", {0x2A81}},
+    {"eparsl", {0x29E3}},
+    {"DownRightVectorBar", {0x2957}},
+    {"Aogon", {0x104}},
+    {"fscr", {0x1D4BB}},
+    {"nsim", {0x2241}},
+    {"hscr", {0x1D4BD}},
+    {"die", {0xA8}},
+    {"Auml", {0xC4}},
+    {"tcedil", {0x163}},
+    {"cirE", {0x29C3}},
+    {"sup", {0x2283}},
+    {"nlsim", {0x2274}},
+    {"Kcy", {0x41A}},
+    {"notni", {0x220C}},
+    {"ropf", {0x1D563}},
+    {"Iacute", {0xCD}},
+    {"ang", {0x2220}},
+    {"bowtie", {0x22C8}},
+    {"LeftRightVector", {0x294E}},
+    {"nsupset", {0x2283, 0x20D2}},
+    {"UpArrowBar", {0x2912}},
+    {"vsubnE", {0x2ACB, 0xFE00}},
+    {"utrif", {0x25B4}},
+    {"pound", {0xA3}},
+    {"Equal", {0x2A75}},
+    {"frac14", {0xBC}},
+    {"cularr", {0x21B6}},
+    {"rang", {0x27E9}},
+    {"mscr", {0x1D4C2}},
+    {"Sum", {0x2211}},
+    {"prurel", {0x22B0}},
+    {"prime", {0x2032}},
+    {"nhArr", {0x21CE}},
+    {"Chi", {0x3A7}},
+    {"copf", {0x1D554}},
+    {"iogon", {0x12F}},
+    {"sqcap", {0x2293}},
+    {"frac23", {0x2154}},
+    {"hookleftarrow", {0x21A9}},
+    {"rtrie", {0x22B5}},
+    {"acirc", {0xE2}},
+    {"pi", {0x3C0}},
+    {"larr", {0x2190}},
+    {"gla", {0x2AA5}},
+    {"andand", {0x2A55}},
+    {"boxVR", {0x2560}},
+    {"ntriangleright", {0x22EB}},
+    {"blacktriangleright", {0x25B8}},
+    {"Vee", {0x22C1}},
+    {"aring", {0xE5}},
+    {"boxh", {0x2500}},
+    {"subne", {0x228A}},
+    {"glE", {0x2A92}},
+    {"colon", {0x3A}},
+    {"ouml", {0xF6}},
+    {"utri", {0x25B5}},
+    {"ogt", {0x29C1}},
+    {"frac16", {0x2159}},
+    {"easter", {0x2A6E}},
+    {"rdca", {0x2937}},
+    {"Ll", {0x22D8}},
+    {"Tcaron", {0x164}},
+    {"gtrless", {0x2277}},
+    {"wedbar", {0x2A5F}},
+    {"omega", {0x3C9}},
+    {"lesdotor", {0x2A83}},
+    {"Congruent", {0x2261}},
+    {"otilde", {0xF5}},
+    {"hookrightarrow", {0x21AA}},
+    {"xharr", {0x27F7}},
+    {"loang", {0x27EC}},
+    {"NotEqual", {0x2260}},
+    {"supset", {0x2283}},
+    {"eqcirc", {0x2256}},
+    {"maltese", {0x2720}},
+    {"reals", {0x211D}},
+    {"rlarr", {0x21C4}},
+    {"ordf", {0xAA}},
+    {"dfr", {0x1D521}},
+    {"intcal", {0x22BA}},
+    {"zwj", {0x200D}},
+    {"subedot", {0x2AC3}},
+    {"ltquest", {0x2A7B}},
+    {"DiacriticalDoubleAcute", {0x2DD}},
+    {"realine", {0x211B}},
+    {"frac35", {0x2157}},
+    {"emsp", {0x2003}},
+    {"rcub", {0x7D}},
+    {"seswar", {0x2929}},
+    {"plusdo", {0x2214}},
+    {"mp", {0x2213}},
+    {"frac38", {0x215C}},
+    {"DifferentialD", {0x2146}},
+    {"Rrightarrow", {0x21DB}},
+    {"lbrace", {0x7B}},
+    {"biguplus", {0x2A04}},
+    {"comma", {0x2C}},
+    {"tprime", {0x2034}},
+    {"filig", {0xFB01}},
+    {"imagpart", {0x2111}},
+    {"micro", {0xB5}},
+    {"rarrb", {0x21E5}},
+    {"Bcy", {0x411}},
+    {"ufisht", {0x297E}},
+    {"Yfr", {0x1D51C}},
+    {"ssmile", {0x2323}},
+    {"bsolb", {0x29C5}},
+    {"Map", {0x2905}},
+    {"nrarrc", {0x2933, 0x338}},
+    {"scy", {0x441}},
+    {"RightUpVectorBar", {0x2954}},
+    {"awconint", {0x2233}},
+    {"bprime", {0x2035}},
+    {"NotLessLess", {0x226A, 0x338}},
+    {"downharpoonleft", {0x21C3}},
+    {"gtrdot", {0x22D7}},
+    {"sqcaps", {0x2293, 0xFE00}},
+    {"Esim", {0x2A73}},
+    {"Vopf", {0x1D54D}},
+    {"tridot", {0x25EC}},
+    {"simlE", {0x2A9F}},
+    {"longleftrightarrow", {0x27F7}},
+    {"ropar", {0x2986}},
+    {"Zdot", {0x17B}},
+    {"VerticalTilde", {0x2240}},
+    {"lcedil", {0x13C}},
+    {"triminus", {0x2A3A}},
+    {"varsupsetneqq", {0x2ACC, 0xFE00}},
+    {"TRADE", {0x2122}},
+    {"Dagger", {0x2021}},
+    {"LeftTriangleBar", {0x29CF}},
+    {"HumpDownHump", {0x224E}},
+    {"nvrArr", {0x2903}},
+    {"LeftArrow", {0x2190}},
+    {"Rfr", {0x211C}},
+    {"triplus", {0x2A39}},
+    {"NotLessTilde", {0x2274}},
+    {"raemptyv", {0x29B3}},
+    {"boxhd", {0x252C}},
+    {"mlcp", {0x2ADB}},
+    {"eogon", {0x119}},
+    {"circledR", {0xAE}},
+    {"bullet", {0x2022}},
+    {"ultri", {0x25F8}},
+    {"lfr", {0x1D529}},
+    {"ThickSpace", {0x205F, 0x200A}},
+    {"bfr", {0x1D51F}},
+    {"nge", {0x2271}},
+    {"rtrif", {0x25B8}},
+    {"Escr", {0x2130}},
+    {"RightUpDownVector", {0x294F}},
+    {"zigrarr", {0x21DD}},
+    {"ecaron", {0x11B}},
+    {"curarr", {0x21B7}},
+    {"nlE", {0x2266, 0x338}},
+    {"niv", {0x220B}},
+    {"nis", {0x22FC}},
+    {"Hfr", {0x210C}},
+    {"RightDoubleBracket", {0x27E7}},
+    {"gesl", {0x22DB, 0xFE00}},
+    {"gtreqqless", {0x2A8C}},
+    {"loz", {0x25CA}},
+    {"NotHumpDownHump", {0x224E, 0x338}},
+    {"demptyv", {0x29B1}},
+    {"nsucceq", {0x2AB0, 0x338}},
+    {"Dashv", {0x2AE4}},
+    {"jsercy", {0x458}},
+    {"Gammad", {0x3DC}},
+    {"Uogon", {0x172}},
+    {"boxUl", {0x255C}},
+    {"lne", {0x2A87}},
+    {"UpArrow", {0x2191}},
+    {"NotTildeTilde", {0x2249}},
+    {"boxDl", {0x2556}},
+    {"in", {0x2208}},
+    {"rnmid", {0x2AEE}},
+    {"curvearrowright", {0x21B7}},
+    {"lthree", {0x22CB}},
+    {"IOcy", {0x401}},
+    {"af", {0x2061}},
+    {"ngeq", {0x2271}},
+    {"nsubE", {0x2AC5, 0x338}},
+    {"Vdash", {0x22A9}},
+    {"qprime", {0x2057}},
+    {"Implies", {0x21D2}},
+    {"NotSucceeds", {0x2281}},
+    {"rarrw", {0x219D}},
+    {"NotGreaterLess", {0x2279}},
+    {"centerdot", {0xB7}},
+    {"Kscr", {0x1D4A6}},
+    {"lesdot", {0x2A7F}},
+    {"rbrksld", {0x298E}},
+    {"upsi", {0x3C5}},
+    {"Cap", {0x22D2}},
+    {"Lang", {0x27EA}},
+    {"trade", {0x2122}},
+    {"theta", {0x3B8}},
+    {"nGg", {0x22D9, 0x338}},
+    {"rarrlp", {0x21AC}},
+    {"ngsim", {0x2275}},
+    {"copysr", {0x2117}},
+    {"bigtriangledown", {0x25BD}},
+    {"urcorn", {0x231D}},
+    {"igrave", {0xEC}},
+    {"supplus", {0x2AC0}},
+    {"minusdu", {0x2A2A}},
+    {"boxvl", {0x2524}},
+    {"boxdr", {0x250C}},
+    {"DownRightTeeVector", {0x295F}},
+    {"IEcy", {0x415}},
+    {"ImaginaryI", {0x2148}},
+    {"subnE", {0x2ACB}},
+    {"nGtv", {0x226B, 0x338}},
+    {"bot", {0x22A5}},
+    {"square", {0x25A1}},
+    {"lharu", {0x21BC}},
+    {"curvearrowleft", {0x21B6}},
+    {"supe", {0x2287}},
+    {"curlywedge", {0x22CF}},
+    {"ccedil", {0xE7}},
+    {"lessdot", {0x22D6}},
+    {"dharl", {0x21C3}},
+    {"gfr", {0x1D524}},
+    {"nrtri", {0x22EB}},
+    {"Cross", {0x2A2F}},
+    {"sdote", {0x2A66}},
+    {"LeftFloor", {0x230A}},
+    {"loplus", {0x2A2D}},
+    {"natur", {0x266E}},
+    {"searrow", {0x2198}},
+    {"ascr", {0x1D4B6}},
+    {"xsqcup", {0x2A06}},
+    {"rsquo", {0x2019}},
+    {"lhard", {0x21BD}},
+    {"geqq", {0x2267}},
+    {"simrarr", {0x2972}},
+    {"nparsl", {0x2AFD, 0x20E5}},
+    {"lt", {0x3C}},
+    {"lnapprox", {0x2A89}},
+    {"oint", {0x222E}},
+    {"Longleftrightarrow", {0x27FA}},
+    {"eqsim", {0x2242}},
+    {"dArr", {0x21D3}},
+    {"NotTildeEqual", {0x2244}},
+    {"RightTriangleBar", {0x29D0}},
+    {"pointint", {0x2A15}},
+    {"bcy", {0x431}},
+    {"GreaterFullEqual", {0x2267}},
+    {"sce", {0x2AB0}},
+    {"gl", {0x2277}},
+    {"Assign", {0x2254}},
+    {"Itilde", {0x128}},
+    {"Gopf", {0x1D53E}},
+    {"rationals", {0x211A}},
+    {"planck", {0x210F}},
+    {"rdquo", {0x201D}},
+    {"bigcup", {0x22C3}},
+    {"equest", {0x225F}},
+    {"bsolhsub", {0x27C8}},
+    {"NotNestedGreaterGreater", {0x2AA2, 0x338}},
+    {"Theta", {0x398}},
+    {"gneqq", {0x2269}},
+    {"ecir", {0x2256}},
+    {"notnivb", {0x22FE}},
+    {"cudarrl", {0x2938}},
+    {"doteqdot", {0x2251}},
+    {"nbump", {0x224E, 0x338}},
+    {"frac34", {0xBE}},
+    {"orslope", {0x2A57}},
+    {"sim", {0x223C}},
+    {"SubsetEqual", {0x2286}},
+    {"tcaron", {0x165}},
+    {"ltcc", {0x2AA6}},
+    {"vDash", {0x22A8}},
+    {"zhcy", {0x436}},
+    {"ijlig", {0x133}},
+    {"DZcy", {0x40F}},
+    {"scap", {0x2AB8}},
+    {"gnE", {0x2269}},
+    {"ShortDownArrow", {0x2193}},
+    {"DDotrahd", {0x2911}},
+    {"ltlarr", {0x2976}},
+    {"Uscr", {0x1D4B0}},
+    {"kcedil", {0x137}},
+    {"thinsp", {0x2009}},
+    {"frac58", {0x215D}},
+    {"wfr", {0x1D534}},
+    {"blk14", {0x2591}},
+    {"ThinSpace", {0x2009}},
+    {"odot", {0x2299}},
+    {"Poincareplane", {0x210C}},
+    {"Element", {0x2208}},
+    {"ffllig", {0xFB04}},
+    {"Int", {0x222C}},
+    {"apacir", {0x2A6F}},
+    {"lobrk", {0x27E6}},
+    {"nearrow", {0x2197}},
+    {"Gdot", {0x120}},
+    {"vert", {0x7C}},
+    {"scnE", {0x2AB6}},
+    {"dotsquare", {0x22A1}},
+    {"iota", {0x3B9}},
+    {"frac15", {0x2155}},
+    {"jcirc", {0x135}},
+    {"qint", {0x2A0C}},
+    {"precneqq", {0x2AB5}},
+    {"shy", {0xAD}},
+    {"leftarrowtail", {0x21A2}},
+    {"THORN", {0xDE}},
+    {"lsquo", {0x2018}},
+    {"LeftArrowBar", {0x21E4}},
+    {"LessSlantEqual", {0x2A7D}},
+    {"LeftTeeArrow", {0x21A4}},
+    {"gEl", {0x2A8C}},
+    {"notin", {0x2209}},
+    {"notinva", {0x2209}},
+    {"NotLessGreater", {0x2278}},
+    {"boxvL", {0x2561}},
+    {"gsime", {0x2A8E}},
+    {"realpart", {0x211C}},
+    {"KHcy", {0x425}},
+    {"sigma", {0x3C3}},
+    {"roarr", {0x21FE}},
+    {"nLeftarrow", {0x21CD}},
+    {"circlearrowleft", {0x21BA}},
+    {"nbsp", {0xA0}},
+    {"race", {0x223D, 0x331}},
+    {"cwconint", {0x2232}},
+    {"npreceq", {0x2AAF, 0x338}},
+    {"lopar", {0x2985}},
+    {"larrsim", {0x2973}},
+    {"lHar", {0x2962}},
+    {"CloseCurlyDoubleQuote", {0x201D}},
+    {"equals", {0x3D}},
+    {"NoBreak", {0x2060}},
+    {"divonx", {0x22C7}},
+    {"setmn", {0x2216}},
+    {"UpperLeftArrow", {0x2196}},
+    {"imacr", {0x12B}},
+    {"tstrok", {0x167}},
+    {"hellip", {0x2026}},
+    {"neArr", {0x21D7}},
+    {"tilde", {0x2DC}},
+    {"rsqb", {0x5D}},
+    {"glj", {0x2AA4}},
+    {"rbrack", {0x5D}},
+    {"LT", {0x3C}},
+    {"approxeq", {0x224A}},
+    {"nsce", {0x2AB0, 0x338}},
+    {"Hat", {0x5E}},
+    {"Ocy", {0x41E}},
+    {"xoplus", {0x2A01}},
+    {"DownArrowBar", {0x2913}},
+    {"NestedGreaterGreater", {0x226B}},
+    {"Sacute", {0x15A}},
+    {"oS", {0x24C8}},
+    {"swnwar", {0x292A}},
+    {"succ", {0x227B}},
+    {"frac18", {0x215B}},
+    {"ic", {0x2063}},
+    {"SquareUnion", {0x2294}},
+    {"trisb", {0x29CD}},
+    {"Leftarrow", {0x21D0}},
+    {"iquest", {0xBF}},
+    {"DotDot", {0x20DC}},
+    {"vnsub", {0x2282, 0x20D2}},
+    {"ulcorn", {0x231C}},
+    {"dash", {0x2010}},
+    {"exist", {0x2203}},
+    {"minusd", {0x2238}},
+    {"rbrke", {0x298C}},
+    {"telrec", {0x2315}},
+    {"squ", {0x25A1}},
+    {"solb", {0x29C4}},
+    {"LeftTriangle", {0x22B2}},
+    {"orv", {0x2A5B}},
+    {"NotExists", {0x2204}},
+    {"phmmat", {0x2133}},
+    {"rceil", {0x2309}},
+    {"ape", {0x224A}},
+    {"squarf", {0x25AA}},
+    {"commat", {0x40}},
+    {"SquareSubset", {0x228F}},
+    {"olt", {0x29C0}},
+    {"midcir", {0x2AF0}},
+    {"VerticalBar", {0x2223}},
+    {"suphsol", {0x27C9}},
+    {"boxH", {0x2550}},
+    {"ltrie", {0x22B4}},
+    {"eplus", {0x2A71}},
+    {"straightphi", {0x3D5}},
+    {"vprop", {0x221D}},
+    {"aleph", {0x2135}},
+    {"nap", {0x2249}},
+    {"cirscir", {0x29C2}},
+    {"LJcy", {0x409}},
+    {"nparallel", {0x2226}},
+    {"gescc", {0x2AA9}},
+    {"ufr", {0x1D532}},
+    {"TildeEqual", {0x2243}},
+    {"LeftUpVectorBar", {0x2958}},
+    {"exponentiale", {0x2147}},
+    {"boxuL", {0x255B}},
+    {"sscr", {0x1D4C8}},
+    {"epsiv", {0x3F5}},
+    {"nsime", {0x2244}},
+    {"Wscr", {0x1D4B2}},
+    {"ncap", {0x2A43}},
+    {"PlusMinus", {0xB1}},
+    {"Iuml", {0xCF}},
+    {"curlyeqprec", {0x22DE}},
+    {"simg", {0x2A9E}},
+    {"NotSupersetEqual", {0x2289}},
+    {"zcaron", {0x17E}},
+    {"ocirc", {0xF4}},
+    {"nang", {0x2220, 0x20D2}},
+    {"supdsub", {0x2AD8}},
+    {"Omega", {0x3A9}},
+    {"Tab", {0x9}},
+    {"Because", {0x2235}},
+    {"nvHarr", {0x2904}},
+    {"hArr", {0x21D4}},
+    {"approx", {0x2248}},
+    {"supsim", {0x2AC8}},
+    {"zeetrf", {0x2128}},
+    {"cuepr", {0x22DE}},
+    {"UpArrowDownArrow", {0x21C5}},
+    {"timesb", {0x22A0}},
+    {"ltimes", {0x22C9}},
+    {"NotRightTriangle", {0x22EB}},
+    {"clubsuit", {0x2663}},
+    {"Bopf", {0x1D539}},
+    {"scnap", {0x2ABA}},
+    {"ncong", {0x2247}},
+    {"rightharpoonup", {0x21C0}},
+    {"UnderBracket", {0x23B5}},
+    {"Lfr", {0x1D50F}},
+    {"Kopf", {0x1D542}},
+    {"epar", {0x22D5}},
+    {"barwedge", {0x2305}},
+    {"vBarv", {0x2AE9}},
+    {"wr", {0x2240}},
+    {"Darr", {0x21A1}},
+    {"notnivc", {0x22FD}},
+    {"subset", {0x2282}},
+    {"subseteq", {0x2286}},
+    {"ntrianglelefteq", {0x22EC}},
+    {"nsubseteqq", {0x2AC5, 0x338}},
+    {"nwnear", {0x2927}},
+    {"lcy", {0x43B}},
+    {"bigodot", {0x2A00}},
+    {"ngtr", {0x226F}},
+    {"Fscr", {0x2131}},
+    {"rbbrk", {0x2773}},
+    {"uacute", {0xFA}},
+    {"jscr", {0x1D4BF}},
+    {"Utilde", {0x168}},
+    {"uwangle", {0x29A7}},
+    {"Colone", {0x2A74}},
+    {"gtquest", {0x2A7C}},
+    {"angmsdaf", {0x29AD}},
+    {"RightAngleBracket", {0x27E9}},
+    {"Wedge", {0x22C0}},
+    {"Lcaron", {0x13D}},
+    {"DoubleLongLeftArrow", {0x27F8}},
+    {"napprox", {0x2249}},
+    {"efr", {0x1D522}},
+    {"pitchfork", {0x22D4}},
+    {"Updownarrow", {0x21D5}},
+    {"Ugrave", {0xD9}},
+    {"sung", {0x266A}},
+    {"ldsh", {0x21B2}},
+    {"Xi", {0x39E}},
+    {"lotimes", {0x2A34}},
+    {"forkv", {0x2AD9}},
+    {"thetav", {0x3D1}},
+    {"xotime", {0x2A02}},
+    {"KJcy", {0x40C}},
+    {"rdsh", {0x21B3}},
+    {"xdtri", {0x25BD}},
+    {"strns", {0xAF}},
+    {"straightepsilon", {0x3F5}},
+    {"nvrtrie", {0x22B5, 0x20D2}},
+    {"Hopf", {0x210D}},
+    {"Ubrcy", {0x40E}},
+    {"nrtrie", {0x22ED}},
+    {"intprod", {0x2A3C}},
+    {"cap", {0x2229}},
+    {"Psi", {0x3A8}},
+    {"UpEquilibrium", {0x296E}},
+    {"rfr", {0x1D52F}},
+    {"popf", {0x1D561}},
+    {"Equilibrium", {0x21CC}},
+    {"sqsube", {0x2291}},
+    {"ldrushar", {0x294B}},
+    {"ne", {0x2260}},
+    {"vartriangleleft", {0x22B2}},
+    {"planckh", {0x210E}},
+    {"vcy", {0x432}},
+    {"gesdot", {0x2A80}},
+    {"xfr", {0x1D535}},
+    {"bumpeq", {0x224F}},
+    {"Kappa", {0x39A}},
+    {"npr", {0x2280}},
+    {"coprod", {0x2210}},
+    {"nsub", {0x2284}},
+    {"ETH", {0xD0}},
+    {"kappav", {0x3F0}},
+    {"nwarhk", {0x2923}},
+    {"LeftUpVector", {0x21BF}},
+    {"ell", {0x2113}},
+    {"icy", {0x438}},
+    {"Gt", {0x226B}},
+    {"bne", {0x3D, 0x20E5}},
+    {"frasl", {0x2044}},
+    {"ensp", {0x2002}},
+    {"beta", {0x3B2}},
+    {"subseteqq", {0x2AC5}},
+    {"veebar", {0x22BB}},
+    {"subdot", {0x2ABD}},
+    {"ubrcy", {0x45E}},
+    {"lsim", {0x2272}},
+    {"Mellintrf", {0x2133}},
+    {"escr", {0x212F}},
+    {"uhblk", {0x2580}},
+    {"lneqq", {0x2268}},
+    {"IJlig", {0x132}},
+    {"lsqb", {0x5B}},
+    {"leftrightsquigarrow", {0x21AD}},
+    {"SHcy", {0x428}},
+    {"ncedil", {0x146}},
+    {"eqslantless", {0x2A95}},
+    {"yacute", {0xFD}},
+    {"varkappa", {0x3F0}},
+    {"dzigrarr", {0x27FF}},
+    {"uopf", {0x1D566}},
+    {"iexcl", {0xA1}},
+    {"swArr", {0x21D9}},
+    {"Ffr", {0x1D509}},
+    {"esim", {0x2242}},
+    {"angrtvbd", {0x299D}},
+    {"div", {0xF7}},
+    {"Ccaron", {0x10C}},
+    {"Nfr", {0x1D511}},
+    {"nshortparallel", {0x2226}},
+    {"DJcy", {0x402}},
+    {"barwed", {0x2305}},
+    {"ni", {0x220B}},
+    {"chi", {0x3C7}},
+    {"ntlg", {0x2278}},
+    {"Precedes", {0x227A}},
+    {"rarrfs", {0x291E}},
+    {"upuparrows", {0x21C8}},
+    {"udarr", {0x21C5}},
+    {"cuwed", {0x22CF}},
+    {"lbrke", {0x298B}},
+    {"leftharpoonup", {0x21BC}},
+    {"eqslantgtr", {0x2A96}},
+    {"Xfr", {0x1D51B}},
+    {"Udblac", {0x170}},
+    {"SquareSuperset", {0x2290}},
+    {"lessapprox", {0x2A85}},
+    {"ReverseEquilibrium", {0x21CB}},
+    {"vartheta", {0x3D1}},
+    {"xcirc", {0x25EF}},
+    {"supedot", {0x2AC4}},
+    {"les", {0x2A7D}},
+    {"LeftTee", {0x22A3}},
+    {"cfr", {0x1D520}},
+    {"bigotimes", {0x2A02}},
+    {"or", {0x2228}},
+    {"CapitalDifferentialD", {0x2145}},
+    {"Iscr", {0x2110}},
+    {"mcomma", {0x2A29}},
+    {"xopf", {0x1D569}},
+    {"topbot", {0x2336}},
+    {"rBarr", {0x290F}},
+    {"EmptySmallSquare", {0x25FB}},
+    {"eopf", {0x1D556}},
+    {"EqualTilde", {0x2242}},
+    {"varr", {0x2195}},
+    {"tosa", {0x2929}},
+    {"robrk", {0x27E7}},
+    {"Ecirc", {0xCA}},
+    {"napid", {0x224B, 0x338}},
+    {"rhard", {0x21C1}},
+    {"npolint", {0x2A14}},
+    {"subsim", {0x2AC7}},
+    {"Pcy", {0x41F}},
+    {"nesim", {0x2242, 0x338}},
+    {"longmapsto", {0x27FC}},
+    {"RightDownVector", {0x21C2}},
+    {"nleftarrow", {0x219A}},
+    {"nsupseteqq", {0x2AC6, 0x338}},
+    {"Dopf", {0x1D53B}},
+    {"wedge", {0x2227}},
+    {"andd", {0x2A5C}},
+    {"Hscr", {0x210B}},
+    {"complexes", {0x2102}},
+    {"ltrPar", {0x2996}},
+    {"sube", {0x2286}},
+    {"cupcap", {0x2A46}},
+    {"urcorner", {0x231D}},
+    {"LongRightArrow", {0x27F6}},
+    {"frac12", {0xBD}},
+    {"NotLessEqual", {0x2270}},
+    {"rsquor", {0x2019}},
+    {"scnsim", {0x22E9}},
+    {"Therefore", {0x2234}},
+    {"Acirc", {0xC2}},
+    {"iopf", {0x1D55A}},
+    {"Phi", {0x3A6}},
+    {"lvnE", {0x2268, 0xFE00}},
+    {"rscr", {0x1D4C7}},
+    {"sup3", {0xB3}},
+    {"emsp14", {0x2005}},
+    {"NotSquareSupersetEqual", {0x22E3}},
+    {"yacy", {0x44F}},
+    {"bigtriangleup", {0x25B3}},
+    {"RBarr", {0x2910}},
+    {"Hstrok", {0x126}},
+    {"Tfr", {0x1D517}},
+    {"Rsh", {0x21B1}},
+    {"rarrpl", {0x2945}},
+    {"equiv", {0x2261}},
+    {"rharul", {0x296C}},
+    {"Ycirc", {0x176}},
+    {"RoundImplies", {0x2970}},
+    {"SOFTcy", {0x42C}},
+    {"djcy", {0x452}},
+    {"lpar", {0x28}},
+    {"esdot", {0x2250}},
+    {"UpperRightArrow", {0x2197}},
+    {"Diamond", {0x22C4}},
+    {"rAarr", {0x21DB}},
+    {"harr", {0x2194}},
+    {"sdot", {0x22C5}},
+    {"gtrarr", {0x2978}},
+    {"Alpha", {0x391}},
+    {"rcaron", {0x159}},
+    {"oelig", {0x153}},
+    {"smt", {0x2AAA}},
+    {"eg", {0x2A9A}},
+    {"dopf", {0x1D555}},
+    {"yicy", {0x457}},
+    {"curren", {0xA4}},
+    {"dagger", {0x2020}},
+    {"Proportion", {0x2237}},
+    {"sqsupseteq", {0x2292}},
+    {"Atilde", {0xC3}},
+    {"InvisibleTimes", {0x2062}},
+    {"LessLess", {0x2AA1}},
+    {"isinE", {0x22F9}},
+    {"GreaterLess", {0x2277}},
+    {"coloneq", {0x2254}},
+    {"Mscr", {0x2133}},
+    {"brvbar", {0xA6}},
+    {"diam", {0x22C4}},
+    {"rpar", {0x29}},
+    {"sigmav", {0x3C2}},
+    {"succapprox", {0x2AB8}},
+    {"nrarrw", {0x219D, 0x338}},
+    {"compfn", {0x2218}},
+    {"Uopf", {0x1D54C}},
+    {"PartialD", {0x2202}},
+    {"parallel", {0x2225}},
+    {"Ncy", {0x41D}},
+    {"csup", {0x2AD0}},
+    {"lltri", {0x25FA}},
+    {"ddagger", {0x2021}},
+    {"ring", {0x2DA}},
+    {"nrightarrow", {0x219B}},
+    {"nvDash", {0x22AD}},
+    {"NotLeftTriangle", {0x22EA}},
+    {"napos", {0x149}},
+    {"Succeeds", {0x227B}},
+    {"SucceedsTilde", {0x227F}},
+    {"leq", {0x2264}},
+    {"LongLeftRightArrow", {0x27F7}},
+    {"hslash", {0x210F}},
+    {"zscr", {0x1D4CF}},
+    {"lBarr", {0x290E}},
+    {"ddotseq", {0x2A77}},
+    {"gel", {0x22DB}},
+    {"eDDot", {0x2A77}},
+    {"therefore", {0x2234}},
+    {"slarr", {0x2190}},
+    {"equivDD", {0x2A78}},
+    {"rect", {0x25AD}},
+    {"leftthreetimes", {0x22CB}},
+    {"rarrsim", {0x2974}},
+    {"looparrowleft", {0x21AB}},
+    {"aogon", {0x105}},
+    {"Cedilla", {0xB8}},
+    {"Scaron", {0x160}},
+    {"nbumpe", {0x224F, 0x338}},
+    {"nVdash", {0x22AE}},
+    {"LeftVectorBar", {0x2952}},
+    {"iuml", {0xEF}},
+    {"RightFloor", {0x230B}},
+    {"nequiv", {0x2262}},
+    {"UnderParenthesis", {0x23DD}},
+    {"NotGreaterEqual", {0x2271}},
+    {"homtht", {0x223B}},
+    {"nacute", {0x144}},
+    {"bepsi", {0x3F6}},
+    {"GreaterEqualLess", {0x22DB}},
+    {"bsim", {0x223D}},
+    {"upsilon", {0x3C5}},
+    {"bigstar", {0x2605}},
+    {"Aopf", {0x1D538}},
+    {"sstarf", {0x22C6}},
+    {"circlearrowright", {0x21BB}},
+    {"risingdotseq", {0x2253}},
+    {"boxdL", {0x2555}},
+    {"succneqq", {0x2AB6}},
+    {"supdot", {0x2ABE}},
+    {"topcir", {0x2AF1}},
+    {"Kcedil", {0x136}},
+    {"euro", {0x20AC}},
+    {"qfr", {0x1D52E}},
+    {"ddarr", {0x21CA}},
+    {"sqsub", {0x228F}},
+    {"vBar", {0x2AE8}},
+    {"npre", {0x2AAF, 0x338}},
+    {"reg", {0xAE}},
+    {"Pr", {0x2ABB}},
+    {"varepsilon", {0x3F5}},
+    {"udblac", {0x171}},
+    {"nshortmid", {0x2224}},
+    {"triangleleft", {0x25C3}},
+    {"omicron", {0x3BF}},
+    {"andv", {0x2A5A}},
+    {"bsol", {0x5C}},
+    {"NotEqualTilde", {0x2242, 0x338}},
+    {"backcong", {0x224C}},
+    {"DownArrowUpArrow", {0x21F5}},
+    {"ncongdot", {0x2A6D, 0x338}},
+    {"angrtvb", {0x22BE}},
+    {"nhpar", {0x2AF2}},
+    {"loarr", {0x21FD}},
+    {"uuml", {0xFC}},
+    {"ntilde", {0xF1}},
+    {"Ocirc", {0xD4}},
+    {"Supset", {0x22D1}},
+    {"Sc", {0x2ABC}},
+    {"bigsqcup", {0x2A06}},
+    {"Lambda", {0x39B}},
+    {"cups", {0x222A, 0xFE00}},
+    {"nges", {0x2A7E, 0x338}},
+    {"par", {0x2225}},
+    {"nsqsube", {0x22E2}},
+    {"SupersetEqual", {0x2287}},
+    {"bscr", {0x1D4B7}},
+    {"langle", {0x27E8}},
+    {"gnapprox", {0x2A8A}},
+    {"Wfr", {0x1D51A}},
+    {"permil", {0x2030}},
+    {"euml", {0xEB}},
+    {"ReverseElement", {0x220B}},
+    {"NotElement", {0x2209}},
+    {"mumap", {0x22B8}},
+    {"Ntilde", {0xD1}},
+    {"blk12", {0x2592}},
+    {"ruluhar", {0x2968}},
+    {"LeftTriangleEqual", {0x22B4}},
+    {"updownarrow", {0x2195}},
+    {"lrm", {0x200E}},
+    {"ffr", {0x1D523}},
+    {"nprcue", {0x22E0}},
+    {"emacr", {0x113}},
+    {"larrhk", {0x21A9}},
+    {"UpDownArrow", {0x2195}},
+    {"vartriangleright", {0x22B3}},
+    {"nu", {0x3BD}},
+    {"Integral", {0x222B}},
+    {"precnsim", {0x22E8}},
+    {"nleqq", {0x2266, 0x338}},
+    {"nsupe", {0x2289}},
+    {"auml", {0xE4}},
+    {"angmsdab", {0x29A9}},
+    {"uHar", {0x2963}},
+    {"toea", {0x2928}},
+    {"DoubleUpArrow", {0x21D1}},
+    {"Afr", {0x1D504}},
+    {"larrbfs", {0x291F}},
+    {"caps", {0x2229, 0xFE00}},
+    {"blacksquare", {0x25AA}},
+    {"fflig", {0xFB00}},
+    {"SquareSupersetEqual", {0x2292}},
+    {"iff", {0x21D4}},
+    {"otimesas", {0x2A36}},
+    {"LessEqualGreater", {0x22DA}},
+    {"latail", {0x2919}},
+    {"boxHU", {0x2569}},
+    {"Proportional", {0x221D}},
+    {"num", {0x23}},
+    {"NotPrecedesEqual", {0x2AAF, 0x338}},
+    {"Nscr", {0x1D4A9}},
+    {"Mfr", {0x1D510}},
+    {"rpargt", {0x2994}},
+    {"ltri", {0x25C3}},
+    {"Popf", {0x2119}},
+    {"rlm", {0x200F}},
+    {"nabla", {0x2207}},
+    {"sqsup", {0x2290}},
+    {"ofr", {0x1D52C}},
+    {"hcirc", {0x125}},
+    {"succsim", {0x227F}},
+    {"alefsym", {0x2135}},
+    {"ltdot", {0x22D6}},
+    {"boxV", {0x2551}},
+    {"mnplus", {0x2213}},
+    {"NotRightTriangleBar", {0x29D0, 0x338}},
+    {"bumpE", {0x2AAE}},
+    {"LeftDownVectorBar", {0x2959}},
+    {"gesdoto", {0x2A82}},
+    {"lrtri", {0x22BF}},
+    {"HARDcy", {0x42A}},
+    {"DoubleLeftTee", {0x2AE4}},
+    {"leftarrow", {0x2190}},
+    {"angmsdae", {0x29AC}},
+    {"softcy", {0x44C}},
+    {"Nu", {0x39D}},
+    {"bNot", {0x2AED}},
+    {"Sigma", {0x3A3}},
+    {"shchcy", {0x449}},
+    {"DownLeftTeeVector", {0x295E}},
+    {"rightleftharpoons", {0x21CC}},
+    {"Uacute", {0xDA}},
+    {"fnof", {0x192}},
+    {"szlig", {0xDF}},
+    {"Rho", {0x3A1}},
+    {"lvertneqq", {0x2268, 0xFE00}},
+    {"apid", {0x224B}},
+    {"boxHD", {0x2566}},
+    {"amp", {0x26}},
+    {"searr", {0x2198}},
+    {"cwint", {0x2231}},
+    {"mho", {0x2127}},
+    {"dstrok", {0x111}},
+    {"mopf", {0x1D55E}},
+    {"nsccue", {0x22E1}},
+    {"lesg", {0x22DA, 0xFE00}},
+    {"cent", {0xA2}},
+    {"Cdot", {0x10A}},
+    {"NegativeVeryThinSpace", {0x200B}},
+    {"becaus", {0x2235}},
+    {"emsp13", {0x2004}},
+    {"TSHcy", {0x40B}},
+    {"eth", {0xF0}},
+    {"DownTee", {0x22A4}},
+    {"Nacute", {0x143}},
+    {"Gscr", {0x1D4A2}},
+    {"Square", {0x25A1}},
+    {"DiacriticalTilde", {0x2DC}},
+    {"hbar", {0x210F}},
+    {"ll", {0x226A}},
+    {"DiacriticalGrave", {0x60}},
+    {"imagline", {0x2110}},
+    {"and", {0x2227}},
+    {"longleftarrow", {0x27F5}},
+    {"rppolint", {0x2A12}},
+    {"boxVr", {0x255F}},
+    {"circledast", {0x229B}},
+    {"boxUr", {0x2559}},
+    {"NotGreaterSlantEqual", {0x2A7E, 0x338}},
+    {"gjcy", {0x453}},
+    {"rhov", {0x3F1}},
+    {"circleddash", {0x229D}},
+    {"yucy", {0x44E}},
+    {"darr", {0x2193}},
+    {"nearr", {0x2197}},
+    {"bottom", {0x22A5}},
+    {"longrightarrow", {0x27F6}},
+    {"Vbar", {0x2AEB}},
+    {"lcub", {0x7B}},
+    {"ltrif", {0x25C2}},
+    {"OverParenthesis", {0x23DC}},
+    {"sol", {0x2F}},
+    {"profline", {0x2312}},
+    {"marker", {0x25AE}},
+    {"Jscr", {0x1D4A5}},
+    {"umacr", {0x16B}},
+    {"there4", {0x2234}},
+    {"ccups", {0x2A4C}},
+    {"subsub", {0x2AD5}},
+    {"FilledVerySmallSquare", {0x25AA}},
+    {"yuml", {0xFF}},
+    {"Igrave", {0xCC}},
+    {"nexist", {0x2204}},
+    {"divide", {0xF7}},
+    {"icirc", {0xEE}},
+    {"NotSucceedsEqual", {0x2AB0, 0x338}},
+    {"harrcir", {0x2948}},
+    {"RightUpTeeVector", {0x295C}},
+    {"ctdot", {0x22EF}},
+    {"Icy", {0x418}},
+    {"forall", {0x2200}},
+    {"vsupnE", {0x2ACC, 0xFE00}},
+    {"zacute", {0x17A}},
+    {"rtri", {0x25B9}},
+    {"hoarr", {0x21FF}},
+    {"succcurlyeq", {0x227D}},
+    {"xlarr", {0x27F5}},
+    {"UnderBar", {0x5F}},
+    {"fopf", {0x1D557}},
+    {"CircleTimes", {0x2297}},
+    {"NotGreaterGreater", {0x226B, 0x338}},
+    {"csub", {0x2ACF}},
+    {"mapsto", {0x21A6}},
+    {"orderof", {0x2134}},
+    {"ecirc", {0xEA}},
+    {"NotReverseElement", {0x220C}},
+    {"Zopf", {0x2124}},
+    {"Vscr", {0x1D4B1}},
+    {"vangrt", {0x299C}},
+    {"expectation", {0x2130}},
+    {"lowbar", {0x5F}},
+    {"Qopf", {0x211A}},
+    {"YAcy", {0x42F}},
+    {"el", {0x2A99}},
+    {"Vcy", {0x412}},
+    {"prnE", {0x2AB5}},
+    {"pm", {0xB1}},
+    {"DD", {0x2145}},
+    {"cross", {0x2717}},
+    {"tritime", {0x2A3B}},
+    {"wopf", {0x1D568}},
+    {"COPY", {0xA9}},
+    {"int", {0x222B}},
+    {"boxul", {0x2518}},
+    {"nesear", {0x2928}},
+    {"bigcirc", {0x25EF}},
+    {"LeftVector", {0x21BC}},
+    {"Beta", {0x392}},
+    {"bbrk", {0x23B5}},
+    {"xrArr", {0x27F9}},
+    {"Rightarrow", {0x21D2}},
+    {"RightCeiling", {0x2309}},
+    {"kjcy", {0x45C}},
+    {"elsdot", {0x2A97}},
+    {"triangleq", {0x225C}},
+    {"leftleftarrows", {0x21C7}},
+    {"duhar", {0x296F}},
+    {"Dcy", {0x414}},
+    {"Pi", {0x3A0}},
+    {"rightrightarrows", {0x21C9}},
+    {"pcy", {0x43F}},
+    {"egrave", {0xE8}},
+    {"llhard", {0x296B}},
+    {"gbreve", {0x11F}},
+    {"ForAll", {0x2200}},
+    {"amacr", {0x101}},
+    {"pluscir", {0x2A22}},
+    {"boxUL", {0x255D}},
+    {"elinters", {0x23E7}},
+    {"rbrkslu", {0x2990}},
+    {"rmoustache", {0x23B1}},
+    {"ograve", {0xF2}},
+    {"prnap", {0x2AB9}},
+    {"PrecedesSlantEqual", {0x227C}},
+    {"Kfr", {0x1D50E}},
+    {"rthree", {0x22CC}},
+    {"laquo", {0xAB}},
+    {"hstrok", {0x127}},
+    {"nscr", {0x1D4C3}},
+    {"Leftrightarrow", {0x21D4}},
+    {"supsub", {0x2AD4}},
+    {"nless", {0x226E}},
+    {"CircleMinus", {0x2296}},
+    {"SHCHcy", {0x429}},
+    {"emptyset", {0x2205}},
+    {"vzigzag", {0x299A}},
+    {"iocy", {0x451}},
+    {"kgreen", {0x138}},
+    {"OElig", {0x152}},
+    {"Delta", {0x394}},
+    {"REG", {0xAE}},
+    {"vellip", {0x22EE}},
+    {"Tcedil", {0x162}},
+    {"ngeqq", {0x2267, 0x338}},
+    {"backsimeq", {0x22CD}},
+    {"sqcup", {0x2294}},
+    {"NotCupCap", {0x226D}},
+    {"thorn", {0xFE}},
+    {"HilbertSpace", {0x210B}},
+    {"precapprox", {0x2AB7}},
+    {"Gcirc", {0x11C}},
+    {"boxdl", {0x2510}},
+    {"precnapprox", {0x2AB9}},
+    {"asymp", {0x2248}},
+    {"NotSquareSuperset", {0x2290, 0x338}},
+    {"hopf", {0x1D559}},
+    {"smte", {0x2AAC}},
+    {"smallsetminus", {0x2216}},
+    {"subsetneq", {0x228A}},
+    {"lE", {0x2266}},
+    {"circledcirc", {0x229A}},
+    {"rsh", {0x21B1}},
+    {"osol", {0x2298}},
+    {"SuchThat", {0x220B}},
+    {"sup2", {0xB2}},
+    {"vfr", {0x1D533}},
+    {"varsubsetneq", {0x228A, 0xFE00}},
+    {"nlt", {0x226E}},
+    {"Oscr", {0x1D4AA}},
+    {"lEg", {0x2A8B}},
+    {"bnot", {0x2310}},
+    {"semi", {0x3B}},
+    {"Vfr", {0x1D519}},
+    {"gtreqless", {0x22DB}},
+    {"lozf", {0x29EB}},
+    {"Sfr", {0x1D516}},
+    {"CHcy", {0x427}},
+    {"between", {0x226C}},
+    {"Eopf", {0x1D53C}},
+    {"Qscr", {0x1D4AC}},
+    {"khcy", {0x445}},
+    {"rarrc", {0x2933}},
+    {"fcy", {0x444}},
+    {"isins", {0x22F4}},
+    {"grave", {0x60}},
+    {"prsim", {0x227E}},
+    {"fjlig", {0x66, 0x6A}},
+    {"Not", {0x2AEC}},
+    {"vnsup", {0x2283, 0x20D2}},
+    {"dtri", {0x25BF}},
+    {"lozenge", {0x25CA}},
+    {"Agrave", {0xC0}},
+    {"notniva", {0x220C}},
+    {"Mu", {0x39C}},
+    {"cupbrcap", {0x2A48}},
+    {"real", {0x211C}},
+    {"roplus", {0x2A2E}},
+    {"roang", {0x27ED}},
+    {"Uuml", {0xDC}},
+    {"Racute", {0x154}},
+    {"Egrave", {0xC8}},
+    {"mldr", {0x2026}},
+    {"ljcy", {0x459}},
+    {"mdash", {0x2014}},
+    {"spades", {0x2660}},
+    {"isinv", {0x2208}},
+    {"dscy", {0x455}},
+    {"Imacr", {0x12A}},
+    {"smashp", {0x2A33}},
+    {"Bumpeq", {0x224E}},
+    {"Product", {0x220F}},
+    {"smile", {0x2323}},
+    {"ENG", {0x14A}},
+    {"ntriangleleft", {0x22EA}},
+    {"frac56", {0x215A}},
+    {"spar", {0x2225}},
+    {"uharl", {0x21BF}},
+    {"nearhk", {0x2924}},
+    {"LeftUpTeeVector", {0x2960}},
+    {"nsmid", {0x2224}},
+    {"propto", {0x221D}},
+    {"GreaterEqual", {0x2265}},
+    {"nmid", {0x2224}},
+    {"Coproduct", {0x2210}},
+    {"boxVH", {0x256C}},
+    {"Intersection", {0x22C2}},
+    {"uml", {0xA8}},
+    {"incare", {0x2105}},
+    {"phi", {0x3C6}},
+    {"Jsercy", {0x408}},
+    {"lsime", {0x2A8D}},
+    {"dtdot", {0x22F1}},
+    {"lmoustache", {0x23B0}},
+    {"rArr", {0x21D2}},
+    {"RightTriangleEqual", {0x22B5}},
+    {"Lopf", {0x1D543}},
+    {"simeq", {0x2243}},
+    {"shortmid", {0x2223}},
+    {"plankv", {0x210F}},
+    {"Im", {0x2111}},
+    {"dwangle", {0x29A6}},
+    {"MinusPlus", {0x2213}},
+    {"ucirc", {0xFB}},
+    {"rfisht", {0x297D}},
+    {"Zscr", {0x1D4B5}},
+    {"Cup", {0x22D3}},
+    {"ngt", {0x226F}},
+    {"lurdshar", {0x294A}},
+    {"blank", {0x2423}},
+    {"Pscr", {0x1D4AB}},
+    {"supseteqq", {0x2AC6}},
+    {"yfr", {0x1D536}},
+    {"DoubleContourIntegral", {0x222F}},
+    {"iiiint", {0x2A0C}},
+    {"dashv", {0x22A3}},
+    {"lesseqqgtr", {0x2A8B}},
+    {"urcrop", {0x230E}},
+    {"emptyv", {0x2205}},
+    {"uparrow", {0x2191}},
+    {"vscr", {0x1D4CB}},
+    {"supsup", {0x2AD6}},
+    {"aacute", {0xE1}},
+    {"Tscr", {0x1D4AF}},
+    {"YIcy", {0x407}},
+    {"tshcy", {0x45B}},
+    {"kfr", {0x1D528}},
+    {"OverBrace", {0x23DE}},
+    {"agrave", {0xE0}},
+    {"nsqsupe", {0x22E3}},
+    {"larrlp", {0x21AB}},
+    {"lopf", {0x1D55D}},
+    {"nvap", {0x224D, 0x20D2}},
+    {"GJcy", {0x403}},
+    {"CircleDot", {0x2299}},
+    {"Lacute", {0x139}},
+    {"CupCap", {0x224D}},
+    {"xutri", {0x25B3}},
+    {"phiv", {0x3D5}},
+    {"afr", {0x1D51E}},
+    {"drcrop", {0x230C}},
+    {"lesssim", {0x2272}},
+    {"xnis", {0x22FB}},
+    {"scE", {0x2AB4}},
+    {"tau", {0x3C4}},
+    {"Ucirc", {0xDB}},
+    {"Qfr", {0x1D514}},
+    {"lsquor", {0x201A}},
+    {"plusacir", {0x2A23}},
+    {"varsupsetneq", {0x228B, 0xFE00}},
+    {"lbarr", {0x290C}},
+    {"eacute", {0xE9}},
+    {"boxVl", {0x2562}},
+    {"Larr", {0x219E}},
+    {"LessGreater", {0x2276}},
+    {"prnsim", {0x22E8}},
+    {"DiacriticalDot", {0x2D9}},
+    {"smtes", {0x2AAC, 0xFE00}},
+    {"comp", {0x2201}},
+    {"tscr", {0x1D4C9}},
+    {"hfr", {0x1D525}},
+    {"Upsi", {0x3D2}},
+    {"plusb", {0x229E}},
+    {"sqsubset", {0x228F}},
+    {"upharpoonright", {0x21BE}},
+    {"NotPrecedes", {0x2280}},
+    {"Dfr", {0x1D507}},
+    {"fallingdotseq", {0x2252}},
+    {"larrfs", {0x291D}},
+    {"thicksim", {0x223C}},
+    {"ggg", {0x22D9}},
+    {"Gbreve", {0x11E}},
+    {"backprime", {0x2035}},
+    {"cirmid", {0x2AEF}},
+    {"Xscr", {0x1D4B3}},
+    {"RightVectorBar", {0x2953}},
+    {"NotTilde", {0x2241}},
+    {"Dot", {0xA8}},
+    {"cylcty", {0x232D}},
+    {"TildeTilde", {0x2248}},
+    {"female", {0x2640}},
+    {"lsaquo", {0x2039}},
+    {"larrb", {0x21E4}},
+    {"gt", {0x3E}},
+    {"Icirc", {0xCE}},
+    {"rdldhar", {0x2969}},
+    {"Ycy", {0x42B}},
+    {"nRightarrow", {0x21CF}},
+    {"njcy", {0x45A}},
+    {"dollar", {0x24}},
+    {"boxhD", {0x2565}},
+    {"ofcir", {0x29BF}},
+    {"Union", {0x22C3}},
+    {"cire", {0x2257}},
+    {"Efr", {0x1D508}},
+    {"psi", {0x3C8}},
+    {"oslash", {0xF8}},
+    {"varpi", {0x3D6}},
+    {"sigmaf", {0x3C2}},
+    {"gesdotol", {0x2A84}},
+    {"complement", {0x2201}},
+    {"varsubsetneqq", {0x2ACB, 0xFE00}},
+    {"Copf", {0x2102}},
+    {"pluse", {0x2A72}},
+    {"timesd", {0x2A30}},
+    {"Omacr", {0x14C}},
+    {"xlArr", {0x27F8}},
+    {"bemptyv", {0x29B0}},
+    {"Lscr", {0x2112}},
+    {"Yacute", {0xDD}},
+    {"ldrdhar", {0x2967}},
+    {"Prime", {0x2033}},
+    {"multimap", {0x22B8}},
+    {"wscr", {0x1D4CC}},
+    {"Rscr", {0x211B}},
+    {"triangle", {0x25B5}},
+    {"empty", {0x2205}},
+    {"daleth", {0x2138}},
+    {"order", {0x2134}},
+    {"Uparrow", {0x21D1}},
+    {"bopf", {0x1D553}},
+    {"odblac", {0x151}},
+    {"eqvparsl", {0x29E5}},
+    {"gvnE", {0x2269, 0xFE00}},
+    {"quot", {0x22}},
+    {"plusdu", {0x2A25}},
+    {"rrarr", {0x21C9}},
+    {"subsetneqq", {0x2ACB}},
+    {"Rarr", {0x21A0}},
+    {"LeftArrowRightArrow", {0x21C6}},
+    {"nvge", {0x2265, 0x20D2}},
+    {"nsup", {0x2285}},
+    {"Lmidot", {0x13F}},
+    {"nsupE", {0x2AC6, 0x338}},
+    {"angrt", {0x221F}},
+    {"infin", {0x221E}},
+    {"geq", {0x2265}},
+    {"NotCongruent", {0x2262}},
+    {"range", {0x29A5}},
+    {"cedil", {0xB8}},
+    {"hamilt", {0x210B}},
+    {"lsh", {0x21B0}},
+    {"hksearow", {0x2925}},
+    {"angzarr", {0x237C}},
+    {"upsih", {0x3D2}},
+    {"lfisht", {0x297C}},
+    {"nvdash", {0x22AC}},
+    {"lbrack", {0x5B}},
+    {"UnionPlus", {0x228E}},
+    {"NegativeMediumSpace", {0x200B}},
+    {"Verbar", {0x2016}},
+    {"lhblk", {0x2584}},
+    {"Zfr", {0x2128}},
+    {"ominus", {0x2296}},
+    {"leqq", {0x2266}},
+    {"curarrm", {0x293C}},
+    {"notinvc", {0x22F6}},
+    {"searhk", {0x2925}},
+    {"ccaron", {0x10D}},
+    {"boxplus", {0x229E}},
+    {"Ncedil", {0x145}},
+    {"boxminus", {0x229F}},
+    {"OverBracket", {0x23B4}},
+    {"supnE", {0x2ACC}},
+    {"bbrktbrk", {0x23B6}},
+    {"gne", {0x2A88}},
+    {"Eta", {0x397}},
+    {"twoheadrightarrow", {0x21A0}},
+    {"dotplus", {0x2214}},
+    {"UnderBrace", {0x23DF}},
+    {"Sscr", {0x1D4AE}},
+    {"ord", {0x2A5D}},
+    {"iinfin", {0x29DC}},
+    {"upharpoonleft", {0x21BF}},
+    {"oror", {0x2A56}},
+    {"InvisibleComma", {0x2063}},
+    {"Backslash", {0x2216}},
+    {"ocir", {0x229A}},
+    {"diams", {0x2666}},
+    {"sharp", {0x266F}},
+    {"supsetneq", {0x228B}},
+    {"plussim", {0x2A26}},
+    {"mapstoleft", {0x21A4}},
+    {"top", {0x22A4}},
+    {"lap", {0x2A85}},
+    {"lrarr", {0x21C6}},
+    {"frac78", {0x215E}},
+    {"lessgtr", {0x2276}},
+    {"capcup", {0x2A47}},
+    {"lates", {0x2AAD, 0xFE00}},
+    {"nfr", {0x1D52B}},
+    {"Rarrtl", {0x2916}},
+    {"boxDR", {0x2554}},
+    {"capand", {0x2A44}},
+    {"gnap", {0x2A8A}},
+    {"lesseqgtr", {0x22DA}},
+    {"ShortLeftArrow", {0x2190}},
+    {"dscr", {0x1D4B9}},
+    {"swarrow", {0x2199}},
+    {"origof", {0x22B6}},
+    {"ast", {0x2A}},
+    {"eqcolon", {0x2255}},
+    {"leftrightarrows", {0x21C6}},
+    {"mstpos", {0x223E}},
+    {"Laplacetrf", {0x2112}},
+    {"HorizontalLine", {0x2500}},
+    {"check", {0x2713}},
+    {"bsime", {0x22CD}},
+    {"kopf", {0x1D55C}},
+    {"circeq", {0x2257}},
+    {"larrtl", {0x21A2}},
+    {"zopf", {0x1D56B}},
+    {"smid", {0x2223}},
+    {"uarr", {0x2191}},
+    {"Rcaron", {0x158}},
+    {"gtrsim", {0x2273}},
+    {"olcross", {0x29BB}},
+    {"utilde", {0x169}},
+    {"le", {0x2264}},
+    {"ndash", {0x2013}},
+    {"squf", {0x25AA}},
+    {"otimes", {0x2297}},
+    {"ecy", {0x44D}},
+    {"efDot", {0x2252}},
+    {"frac45", {0x2158}},
+    {"jukcy", {0x454}},
+    {"bkarow", {0x290D}},
+    {"Gcedil", {0x122}},
+    {"apos", {0x27}},
+    {"acute", {0xB4}},
+    {"nLtv", {0x226A, 0x338}},
+    {"Fouriertrf", {0x2131}},
+    {"DoubleLongRightArrow", {0x27F9}},
+    {"Ecy", {0x42D}},
+    {"gvertneqq", {0x2269, 0xFE00}},
+    {"prec", {0x227A}},
+    {"suplarr", {0x297B}},
+    {"nvinfin", {0x29DE}},
+    {"nsupseteq", {0x2289}},
+    {"xscr", {0x1D4CD}},
+    {"Ccirc", {0x108}},
+    {"angle", {0x2220}},
+    {"profalar", {0x232E}},
+    {"Vdashl", {0x2AE6}},
+    {"oopf", {0x1D560}},
+    {"ffilig", {0xFB03}},
+    {"Abreve", {0x102}},
+    {"Scy", {0x421}},
+    {"NotSucceedsTilde", {0x227F, 0x338}},
+    {"Yuml", {0x178}},
+    {"wcirc", {0x175}},
+    {"rarrtl", {0x21A3}},
+    {"Lleftarrow", {0x21DA}},
+    {"infintie", {0x29DD}},
+    {"odsold", {0x29BC}},
+    {"minus", {0x2212}},
+    {"dtrif", {0x25BE}},
+    {"llcorner", {0x231E}},
+    {"luruhar", {0x2966}},
+    {"leftrightarrow", {0x2194}},
+    {"ngeqslant", {0x2A7E, 0x338}},
+    {"vee", {0x2228}},
+    {"dcaron", {0x10F}},
+    {"nGt", {0x226B, 0x20D2}},
+    {"Ifr", {0x2111}},
+    {"sext", {0x2736}},
+    {"DoubleLongLeftRightArrow", {0x27FA}},
+    {"Iopf", {0x1D540}},
+    {"Emacr", {0x112}},
+    {"Lt", {0x226A}},
+    {"vArr", {0x21D5}},
+    {"lagran", {0x2112}},
+    {"lfloor", {0x230A}},
+    {"xwedge", {0x22C0}},
+    {"backepsilon", {0x3F6}},
+    {"heartsuit", {0x2665}},
+    {"divideontimes", {0x22C7}},
+    {"rsaquo", {0x203A}},
+    {"vltri", {0x22B2}},
+    {"DownLeftVectorBar", {0x2956}},
+    {"bdquo", {0x201E}},
+    {"dfisht", {0x297F}},
+    {"abreve", {0x103}},
+    {"aelig", {0xE6}},
+    {"Cscr", {0x1D49E}},
+    {"colone", {0x2254}},
+    {"blacktriangledown", {0x25BE}},
+    {"lAarr", {0x21DA}},
+    {"CenterDot", {0xB7}},
+    {"NotLess", {0x226E}},
+    {"circ", {0x2C6}},
+    {"iukcy", {0x456}},
+    {"RightTee", {0x22A2}},
+    {"intercal", {0x22BA}},
+    {"angmsdah", {0x29AF}},
+    {"quaternions", {0x210D}},
+    {"sbquo", {0x201A}},
+    {"srarr", {0x2192}},
+    {"awint", {0x2A11}},
+    {"larrpl", {0x2939}},
+    {"Mopf", {0x1D544}},
+    {"nsube", {0x2288}},
+    {"RuleDelayed", {0x29F4}},
+    {"mDDot", {0x223A}},
+    {"vsubne", {0x228A, 0xFE00}},
+    {"uharr", {0x21BE}},
+    {"gacute", {0x1F5}},
+    {"simplus", {0x2A24}},
+    {"ges", {0x2A7E}},
+    {"veeeq", {0x225A}},
+    {"prap", {0x2AB7}},
+    {"downharpoonright", {0x21C2}},
+    {"Omicron", {0x39F}},
+    {"Fcy", {0x424}},
+    {"Oacute", {0xD3}},
+    {"DoubleUpDownArrow", {0x21D5}},
+    {"tbrk", {0x23B4}},
+    {"cemptyv", {0x29B2}},
+    {"cacute", {0x107}},
+    {"Jopf", {0x1D541}},
+    {"SmallCircle", {0x2218}},
+    {"bull", {0x2022}},
+    {"ratio", {0x2236}},
+    {"npar", {0x2226}},
+    {"epsi", {0x3B5}},
+    {"backsim", {0x223D}},
+    {"Zeta", {0x396}},
+    {"caret", {0x2041}},
+    {"NegativeThickSpace", {0x200B}},
+    {"Pfr", {0x1D513}},
+    {"clubs", {0x2663}},
+    {"ContourIntegral", {0x222E}},
+    {"nvsim", {0x223C, 0x20D2}},
+    {"quatint", {0x2A16}},
+    {"Otimes", {0x2A37}},
+    {"varphi", {0x3D5}},
+    {"DoubleVerticalBar", {0x2225}},
+    {"Barwed", {0x2306}},
+    {"ClockwiseContourIntegral", {0x2232}},
+    {"ucy", {0x443}},
+    {"prop", {0x221D}},
+    {"sqsupset", {0x2290}},
+    {"gap", {0x2A86}},
+    {"laemptyv", {0x29B4}},
+    {"triangleright", {0x25B9}},
+    {"nlArr", {0x21CD}},
+    {"nrarr", {0x219B}},
+    {"boxhU", {0x2568}},
+    {"vopf", {0x1D567}},
+    {"nlarr", {0x219A}},
+    {"nle", {0x2270}},
+    {"cir", {0x25CB}},
+    {"rarr", {0x2192}},
+    {"LessFullEqual", {0x2266}},
+    {"rfloor", {0x230B}},
+    {"nvgt", {0x3E, 0x20D2}},
+    {"bsemi", {0x204F}},
+    {"chcy", {0x447}},
+    {"male", {0x2642}},
+    {"Tau", {0x3A4}},
+    {"Oopf", {0x1D546}},
+    {"tdot", {0x20DB}},
+    {"ecolon", {0x2255}},
+    {"isin", {0x2208}},
+    {"dHar", {0x2965}},
+    {"flat", {0x266D}},
+    {"gnsim", {0x22E7}},
+    {"orarr", {0x21BB}},
+    {"lceil", {0x2308}},
+    {"starf", {0x2605}},
+    {"blacktriangle", {0x25B4}},
+    {"ShortRightArrow", {0x2192}},
+    {"Colon", {0x2237}},
+    {"Edot", {0x116}},
+    {"omacr", {0x14D}},
+    {"simgE", {0x2AA0}},
+    {"preccurlyeq", {0x227C}},
+    {"imath", {0x131}},
+    {"tint", {0x222D}},
+    {"uplus", {0x228E}},
+    {"qopf", {0x1D562}},
+    {"GreaterGreater", {0x2AA2}},
+    {"nwarrow", {0x2196}},
+    {"LeftAngleBracket", {0x27E8}},
+    {"ltcir", {0x2A79}},
+    {"ldquo", {0x201C}},
+    {"vsupne", {0x228B, 0xFE00}},
+    {"rcy", {0x440}},
+    {"notinvb", {0x22F7}},
+    {"because", {0x2235}},
+    {"deg", {0xB0}},
+    {"RightVector", {0x21C0}},
+    {"csube", {0x2AD1}},
+    {"thetasym", {0x3D1}},
+    {"pr", {0x227A}},
+    {"OpenCurlyDoubleQuote", {0x201C}},
+    {"zeta", {0x3B6}},
+    {"ycirc", {0x177}},
+    {"lang", {0x27E8}},
+    {"sub", {0x2282}},
+    {"RightArrow", {0x2192}},
+    {"OpenCurlyQuote", {0x2018}},
+    {"supne", {0x228B}},
+    {"looparrowright", {0x21AC}},
+    {"setminus", {0x2216}},
+    {"dsol", {0x29F6}},
+    {"varrho", {0x3F1}},
+    {"gopf", {0x1D558}},
+    {"sdotb", {0x22A1}},
+    {"NotSubsetEqual", {0x2288}},
+    {"Gamma", {0x393}},
+    {"iecy", {0x435}},
+    {"Lcy", {0x41B}},
+    {"Tstrok", {0x166}},
+    {"dotminus", {0x2238}},
+    {"mapstoup", {0x21A5}},
+    {"lacute", {0x13A}},
+    {"rarrbfs", {0x2920}},
+    {"rlhar", {0x21CC}},
+    {"ii", {0x2148}},
+    {"ycy", {0x44B}},
+    {"wedgeq", {0x2259}},
+    {"precsim", {0x227E}},
+    {"macr", {0xAF}},
+    {"boxuR", {0x2558}},
+    {"sup1", {0xB9}},
+    {"capdot", {0x2A40}},
+    {"Zacute", {0x179}},
+    {"NotSucceedsSlantEqual", {0x22E1}},
+    {"ntgl", {0x2279}},
+    {"atilde", {0xE3}},
+    {"lAtail", {0x291B}},
+    {"odash", {0x229D}},
+    {"measuredangle", {0x2221}},
+    {"notinE", {0x22F9, 0x338}},
+    {"harrw", {0x21AD}},
+    {"Lsh", {0x21B0}},
+    {"acd", {0x223F}},
+    {"gE", {0x2267}},
+    {"xcap", {0x22C2}},
+    {"aopf", {0x1D552}},
+    {"cupor", {0x2A45}},
+    {"DoubleDot", {0xA8}},
+    {"lg", {0x2276}},
+    {"wp", {0x2118}},
+    {"Ucy", {0x423}},
+    {"bigvee", {0x22C1}},
+    {"digamma", {0x3DD}},
+    {"gtdot", {0x22D7}},
+    {"NotTildeFullEqual", {0x2247}},
+    {"copy", {0xA9}},
+    {"bnequiv", {0x2261, 0x20E5}},
+    {"ge", {0x2265}},
+    {"frac25", {0x2156}},
+    {"VDash", {0x22AB}},
+    {"qscr", {0x1D4C6}},
+    {"Tilde", {0x223C}},
+    {"iprod", {0x2A3C}},
+    {"diamondsuit", {0x2666}},
+    {"NotDoubleVerticalBar", {0x2226}},
+    {"Mcy", {0x41C}},
+    {"cudarrr", {0x2935}},
+    {"simdot", {0x2A6A}},
+    {"cularrp", {0x293D}},
+    {"NotGreater", {0x226F}},
+    {"lesges", {0x2A93}},
+    {"bernou", {0x212C}},
+    {"NotLeftTriangleEqual", {0x22EC}},
+    {"LeftDoubleBracket", {0x27E6}},
+    {"rightharpoondown", {0x21C1}},
+    {"angmsdag", {0x29AE}},
+    {"DownLeftRightVector", {0x2950}},
+    {"DoubleLeftRightArrow", {0x21D4}},
+    {"apE", {0x2A70}},
+    {"block", {0x2588}},
+    {"uogon", {0x173}},
+    {"tscy", {0x446}},
+    {"Wcirc", {0x174}},
+    {"gdot", {0x121}},
+    {"egs", {0x2A96}},
+    {"Fopf", {0x1D53D}},
+    {"raquo", {0xBB}},
+    {"vdash", {0x22A2}},
+    {"Dstrok", {0x110}},
+    {"udhar", {0x296E}},
+    {"ncy", {0x43D}},
+    {"dblac", {0x2DD}},
+    {"boxv", {0x2502}},
+    {"dlcrop", {0x230D}},
+    {"hercon", {0x22B9}},
+    {"utdot", {0x22F0}},
+    {"shcy", {0x448}},
+    {"parsim", {0x2AF3}},
+    {"NJcy", {0x40A}},
+    {"Scirc", {0x15C}},
+    {"jfr", {0x1D527}},
+    {"nLt", {0x226A, 0x20D2}},
+    {"gsiml", {0x2A90}},
+    {"Jcirc", {0x134}},
+    {"opar", {0x29B7}},
+    {"Iukcy", {0x406}},
+    {"DoubleRightArrow", {0x21D2}},
+    {"trianglerighteq", {0x22B5}},
+    {"Cacute", {0x106}},
+    {"cscr", {0x1D4B8}},
+    {"Dcaron", {0x10E}},
+    {"NotPrecedesSlantEqual", {0x22E0}},
+    {"LowerRightArrow", {0x2198}},
+    {"boxVh", {0x256B}},
+    {"mapstodown", {0x21A7}},
+    {"Tcy", {0x422}},
+    {"Topf", {0x1D54B}},
+    {"subE", {0x2AC5}},
+    {"midast", {0x2A}},
+    {"cdot", {0x10B}},
+    {"boxHu", {0x2567}},
+    {"llarr", {0x21C7}},
+    {"iiint", {0x222D}},
+    {"DotEqual", {0x2250}},
+    {"nsubset", {0x2282, 0x20D2}},
+    {"ovbar", {0x233D}},
+    {"LeftDownTeeVector", {0x2961}},
+    {"Cfr", {0x212D}},
+    {"itilde", {0x129}},
+    {"LessTilde", {0x2272}},
+    {"leqslant", {0x2A7D}},
+    {"prE", {0x2AB3}},
+    {"egsdot", {0x2A98}},
+    {"thickapprox", {0x2248}},
+    {"drbkarow", {0x2910}},
+    {"succnsim", {0x22E9}},
+    {"DownTeeArrow", {0x21A7}},
+    {"star", {0x2606}},
+    {"Umacr", {0x16A}},
+    {"ssetmn", {0x2216}},
+    {"minusb", {0x229F}},
+    {"Xopf", {0x1D54F}},
+    {"primes", {0x2119}},
+    {"nleqslant", {0x2A7D, 0x338}},
+    {"breve", {0x2D8}},
+    {"Sqrt", {0x221A}},
+    {"boxdR", {0x2552}},
+    {"nisd", {0x22FA}},
+    {"succeq", {0x2AB0}},
+    {"questeq", {0x225F}},
+    {"lharul", {0x296A}},
+    {"prcue", {0x227C}},
+    {"NotSquareSubset", {0x228F, 0x338}},
+    {"submult", {0x2AC1}},
+    {"Longrightarrow", {0x27F9}},
+    {"supsetneqq", {0x2ACC}},
+    {"NotNestedLessLess", {0x2AA1, 0x338}},
+    {"sfr", {0x1D530}},
+    {"Ascr", {0x1D49C}},
+    {"Exists", {0x2203}},
+    {"Re", {0x211C}},
+    {"rbrace", {0x7D}},
+    {"numsp", {0x2007}},
+    {"simne", {0x2246}},
+    {"nleq", {0x2270}},
+    {"ac", {0x223E}},
+    {"oplus", {0x2295}},
+    {"zdot", {0x17C}},
+    {"And", {0x2A53}},
+    {"Gg", {0x22D9}},
+    {"lbrkslu", {0x298D}},
+    {"Lstrok", {0x141}},
+    {"DownLeftVector", {0x21BD}},
+    {"oast", {0x229B}},
+    {"perp", {0x22A5}},
+    {"uring", {0x16F}},
+    {"Breve", {0x2D8}},
+    {"xi", {0x3BE}},
+}};
+
+// Per-bucket seed for the second-level hash
+constexpr std::array<std::uint16_t, kBucketCount> kDisplacement = {
+    48, 3, 144, 24, 359, 1, 31, 5, 35, 13, 2, 6, 17, 21, 56, 2, 14, 341, 13, 17,
+    1, 58, 1, 1, 25, 1, 36, 2, 287, 84, 97, 2, 7, 1, 72, 6, 58, 43, 50, 21, 73,
+    12, 134, 14, 105, 212, 18, 46, 25, 2, 59, 178, 1, 1, 64, 52, 49, 20, 2, 12,
+    2, 209, 160, 9, 229, 174, 199, 119, 13, 142, 4, 94, 9, 42, 86, 117, 21, 36,
+    530, 20, 68, 17, 150, 70, 43, 461, 31, 538, 363, 1, 64, 39, 446, 61, 82, 1,
+    309, 64, 172, 25, 282, 89, 77, 29, 47, 14, 95, 1, 376, 74, 0, 5, 2, 0, 277,
+    1, 197, 17, 28, 24, 10, 6, 61, 6, 59, 46, 9, 79, 7, 22, 8, 16, 54, 5, 7,
+    705, 1, 20, 1, 2, 1, 62, 156, 14, 1, 171, 24, 4, 271, 1, 303, 7, 3, 141, 7,
+    42, 4, 97, 5, 1012, 24, 13, 2, 37, 521, 114, 11, 109, 1, 3, 56, 370, 123,
+    120, 8, 115, 14, 8, 78, 10, 321, 2, 4, 2, 57, 55, 37, 116, 3, 106, 21, 1,
+    32, 5, 203, 138, 1, 15, 55, 21, 2, 192, 5, 29, 27, 99, 40, 2, 4, 1, 1, 385,
+    37, 4, 67, 48, 160, 36, 75, 217, 262, 21, 3, 158, 39, 1, 188, 600, 33, 440,
+    5, 3, 7, 171, 1, 140, 28, 6, 133, 111, 138, 412, 179, 12, 56, 9, 159, 744,
+    9, 22, 18, 471, 297, 92, 38, 43, 74, 486, 196, 7, 70, 538, 1495, 90, 47,
+    1723, 280, 4, 10, 1616, 62, 150, 275, 72, 809, 95, 259, 10, 31, 1, 58, 161,
+    965, 82, 505, 438, 595, 21, 3, 73, 2, 179, 630, 185, 2, 194, 339, 2, 22,
+    144, 3, 33, 19, 444, 2, 2, 50, 7, 239, 1336, 947, 44, 42, 35, 1714, 1686,
+    194, 333, 81, 63, 132, 4, 3, 1, 13, 597, 3, 1, 1, 39, 1463, 87, 1149, 2883,
+    17, 10, 103, 1543, 128, 29, 166, 3, 28, 73, 90, 8, 8, 291, 106, 863, 6, 1,
+    1, 15, 30, 101, 0, 239, 659, 269, 6, 1299, 620, 224, 1145, 11, 72, 3, 4, 22,
+    4, 2, 20, 157, 17, 369, 2, 107, 24, 2130, 1209, 5, 1806, 174, 202, 32, 4,
+    297, 439, 33, 76, 713, 91, 1370, 1808, 274, 102, 576, 91, 9, 559, 441, 88,
+    1292, 55, 506, 22, 2095, 37, 6857, 25, 733, 2341, 977, 10, 376, 3294, 223,
+    11, 72, 239, 73, 201, 52, 1316, 41, 12, 54, 2, 2420, 4, 15, 2, 1, 268, 27,
+    5, 275, 40, 5, 386, 281, 392, 3362, 188, 87, 120, 18, 12, 1056, 32, 98,
+    1961, 1560, 137, 445, 130, 58, 1, 124, 748, 248, 2, 109, 18, 525, 797, 75,
+    441, 0, 61, 17, 895, 15, 1, 3190, 575, 131, 1035, 3, 0, 584, 153, 312, 116,
+    32, 3, 11, 127, 71, 8, 4, 1106, 3628, 935, 2, 7778, 1167, 1605, 137, 1, 147,
+    2, 1976, 28, 498, 6755, 11, 822, 0, 426, 631,
+};
+
+// Numeric references to 0x80-0x9F mean the Windows-1252 character, as in
+// browsers (HTML5 "numeric character reference end state")
+constexpr std::array<char32_t, 32> kCP1252Remap = {
+    0x20AC, 0x81,   0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x8D,   0x017D, 0x8F,
+    0x90,   0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x9D,   0x017E, 0x0178};
+
+bool IsNameChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9');
+}
+
+int HexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+std::optional<HtmlEntities::Decoded> DecodeNumeric(std::string_view text) {
+  // text starts with "&#"
+  std::size_t pos = 2;
+  const bool hex = pos < text.size() && (text[pos] == 'x' || text[pos] == 'X');
+  if (hex) {
+    ++pos;
+  }
+
+  const std::size_t digitsStart = pos;
+  std::uint32_t value = 0;
+  for (; pos < text.size(); ++pos) {
+    const int digit = hex ? HexValue(text[pos])
+                          : (text[pos] >= '0' && text[pos] <= '9'
+                                 ? text[pos] - '0'
+                                 : -1);
+    if (digit < 0) {
+      break;
+    }
+    // Saturate just past the Unicode range
+    value = (std::min)(value * (hex ? 16u : 10u) + static_cast<std::uint32_t>(digit),
+                       0x110000u);
+  }
+  if (pos == digitsStart || pos >= text.size() || text[pos] != ';') {
+    return std::nullopt;
+  }
+
+  char32_t codepoint = value;
+  if (value == 0 || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+    codepoint = 0xFFFD;
+  } else if (value >= 0x80 && value <= 0x9F) {
+    codepoint = kCP1252Remap[value - 0x80];
+  } else if (value == '\r') {
+    codepoint = '\n'; // Book line breaks are written as &#13; too
+  }
+
+  HtmlEntities::Decoded decoded;
+  decoded.length = pos + 1;
+  decoded.codepoints[0] = codepoint;
+  decoded.count = 1;
+  return decoded;
+}
+
+} // namespace
+
+std::size_t HtmlEntities::LookupNamed(std::string_view name,
+                                      char32_t *codepoints) {
+  if (name.empty() || name.size() > kMaxNameLength) {
+    return 0;
+  }
+  const auto bucket = HashName(name, 0) % kBucketCount;
+  const auto slot = HashName(name, kDisplacement[bucket]) % kEntityCount;
+  const auto &entity = kEntities[slot];
+  if (entity.name != name) {
+    return 0;
+  }
+  codepoints[0] = entity.codepoints[0];
+  codepoints[1] = entity.codepoints[1];
+  return entity.codepoints[1] != 0 ? 2 : 1;
+}
+
+std::optional<HtmlEntities::Decoded>
+HtmlEntities::Decode(std::string_view text) {
+  if (text.size() < 3 || text[0] != '&') {
+    return std::nullopt;
+  }
+  if (text[1] == '#') {
+    return DecodeNumeric(text);
+  }
+
+  const auto limit = (std::min)(text.size(), kMaxNameLength + 2);
+  std::size_t end = 1;
+  while (end < limit && IsNameChar(text[end])) {
+    ++end;
+  }
+  if (end == 1 || end >= text.size() || text[end] != ';') {
+    return std::nullopt;
+  }
+
+  Decoded decoded;
+  decoded.length = end + 1;
+  decoded.count = LookupNamed(text.substr(1, end - 1), decoded.codepoints);
+  return decoded;
+}
+
+std::size_t HtmlEntities::EncodeUtf8(char32_t codepoint, char *output) {
+  if (codepoint < 0x80) {
+    output[0] = static_cast<char>(codepoint);
+    return 1;
+  }
+  if (codepoint < 0x800) {
+    output[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+    output[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    return 2;
+  }
+  if (codepoint < 0x10000) {
+    output[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+    output[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    output[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    return 3;
+  }
+  output[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+  output[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+  output[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+  output[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+  return 4;
+}
+
+} // namespace Easy2Read
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace Easy2Read {
+
+/**
+ * HTML character reference decoding for book text: all 2125 HTML5 named
+ * references (&eacute;, &mdash;, ...) plus decimal (&#8217;) and hex
+ * (&#x2014;) numeric references. Named references are found through a
+ * minimal perfect hash over a constant table, so decoding never allocates.
+ */
+class HtmlEntities {
+public:
+  struct Decoded {
+    std::size_t length = 0;      // Source bytes consumed, '&' through ';'
+    char32_t codepoints[2] = {}; // Decoded characters
+    std::size_t count = 0;       // 0: well-formed name that isn't an entity
+  };
+
+  /**
+   * Decode the character reference at the start of `text` (text[0] == '&').
+   * @return The decoded reference, or nullopt if `text` doesn't start with a
+   *         well-formed reference (the '&' is then literal text)
+   */
+  [[nodiscard]] static std::optional<Decoded> Decode(std::string_view text);
+
+  /**
+   * Look up a named reference without the '&' and ';' ("eacute").
+   * @return Number of codepoints written to `codepoints` (0 if unknown)
+   */
+  static std::size_t LookupNamed(std::string_view name, char32_t *codepoints);
+
+  /**
+   * Encode a codepoint as UTF-8.
+   * @param output Room for at least 4 bytes
+   * @return Bytes written
+   */
+  static std::size_t EncodeUtf8(char32_t codepoint, char *output);
+};
+
+} // namespace Easy2Read
@@ -4,7 +4,6 @@
 #include <algorithm>
 #include <filesystem>
 
-
 namespace Easy2Read {
 
 ImageMappings *ImageMappings::GetSingleton() {
@@ -70,7 +69,7 @@ void ImageMappings::LoadMappingFile(const std::wstring &filePath) {
       std::string imagePath = key.pItem;
       std::string replacement = value;
 
-      // Normalize the path (forward slashes, lowercase)
+      // Normalize the separators; lookups ignore case
       std::replace(imagePath.begin(), imagePath.end(), '\\', '/');
 
       mappings[imagePath] = replacement;
@@ -79,35 +78,14 @@ void ImageMappings::LoadMappingFile(const std::wstring &filePath) {
   }
 }
 
-std::string ImageMappings::GetReplacement(const std::string &imagePath) const {
-  // Normalize the input path
-  std::string normalized = imagePath;
-  std::replace(normalized.begin(), normalized.end(), '\\', '/');
-
-  // Try direct lookup first
-  auto it = mappings.find(normalized);
-  if (it != mappings.end()) {
-    return it->second;
-  }
-
-  // Try case-insensitive lookup
-  std::string lowerPath = normalized;
-  std::transform(lowerPath.begin(), lowerPath.end(), lowerPath.begin(),
-                 ::tolower);
-
-  for (const auto &[key, value] : mappings) {
-    std::string lowerKey = key;
-    std::transform(lowerKey.begin(), lowerKey.end(), lowerKey.begin(),
-                   ::tolower);
-    if (lowerKey == lowerPath) {
-      return value;
-    }
-  }
-
-  return "";
+std::string_view
+ImageMappings::GetReplacement(std::string_view imagePath) const {
+  auto it = mappings.find(imagePath);
+  return it != mappings.end() ? std::string_view(it->second)
+                              : std::string_view{};
 }
 
-bool ImageMappings::HasMapping(const std::string &imagePath) const {
+bool ImageMappings::HasMapping(std::string_view imagePath) const {
   return !GetReplacement(imagePath).empty();
 }
 
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "ImagePath.h"
+
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace Easy2Read {
@@ -23,14 +27,18 @@ public:
    * Get the text replacement for an image path.
    * @param imagePath The image path from the img tag (e.g.,
    * "Textures/Interface/Books/...")
-   * @return The replacement text, or empty string if no mapping exists
+   * Matching ignores case and treats '\\' and '/' alike; nothing is
+   * allocated.
+   * @return The replacement text (valid until the mappings are reloaded), or
+   * empty if no mapping exists
    */
-  [[nodiscard]] std::string GetReplacement(const std::string &imagePath) const;
+  [[nodiscard]] std::string_view
+  GetReplacement(std::string_view imagePath) const;
 
   /**
    * Check if a mapping exists for the given path.
    */
-  [[nodiscard]] bool HasMapping(const std::string &imagePath) const;
+  [[nodiscard]] bool HasMapping(std::string_view imagePath) const;
 
   /**
    * Get the number of loaded mappings.
@@ -48,8 +56,10 @@ private:
 
   void LoadMappingFile(const std::wstring &filePath);
 
-  // Map of image path -> replacement text
-  std::unordered_map<std::string, std::string> mappings;
+  // Map of image path -> replacement text, matched as ImagePath describes
+  std::unordered_map<std::string, std::string, ImagePath::Hash,
+                     ImagePath::Equal>
+      mappings;
 };
 
 } // namespace Easy2Read
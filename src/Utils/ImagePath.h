@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+namespace Easy2Read {
+
+/**
+ * How image paths from book markup are matched against mapping files: case
+ * is ignored and '\\' matches '/'. Header-only so desktop tools match paths
+ * exactly like ImageMappings does in game.
+ */
+struct ImagePath {
+  // Folds case and path separators so "Textures\\A.dds" matches
+  // "textures/a.dds"
+  [[nodiscard]] static constexpr char Fold(char c) {
+    if (c == '\\') {
+      return '/';
+    }
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+  }
+
+  // Transparent, so string_view paths are looked up without a copy
+  struct Hash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view path) const noexcept {
+      // FNV-1a over the folded characters
+      std::size_t hash = 14695981039346656037ull;
+      for (const char c : path) {
+        hash ^= static_cast<unsigned char>(Fold(c));
+        hash *= 1099511628211ull;
+      }
+      return hash;
+    }
+  };
+
+  struct Equal {
+    using is_transparent = void;
+    bool operator()(std::string_view a, std::string_view b) const noexcept {
+      return a.size() == b.size() &&
+             std::equal(a.begin(), a.end(), b.begin(),
+                        [](char x, char y) { return Fold(x) == Fold(y); });
+    }
+  };
+};
+
+} // namespace Easy2Read
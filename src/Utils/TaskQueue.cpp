@@ -0,0 +1,108 @@
+#include "TaskQueue.h"
+#include "PCH.h"
+
+namespace Easy2Read {
+
+TaskQueue *TaskQueue::GetSingleton() {
+  static TaskQueue singleton;
+  return &singleton;
+}
+
+void TaskQueue::Start(std::size_t threadCount) {
+  std::lock_guard lock(lock_);
+  if (running_) {
+    return;
+  }
+
+  if (threadCount == 0) {
+    // Leave the cores to the game; text work is light and latency-tolerant
+    const auto cores = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::clamp<std::size_t>(cores / 4, 1, 2);
+  }
+
+  running_ = true;
+  workers_.reserve(threadCount);
+  for (std::size_t i = 0; i < threadCount; ++i) {
+    workers_.emplace_back(&TaskQueue::WorkerLoop, this);
+  }
+
+  SKSE::log::info("TaskQueue: Started {} worker thread(s)", threadCount);
+}
+
+TaskQueue::~TaskQueue() {
+  // Only reached at process teardown without Shutdown(), when Windows has
+  // already ended the workers; joining them (or taking a lock one may have
+  // held) would never return
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.detach();
+    }
+  }
+}
+
+void TaskQueue::Shutdown() {
+  std::vector<std::thread> workers;
+  {
+    std::lock_guard lock(lock_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+    cancelled_.fetch_add(queue_.size(), std::memory_order_relaxed);
+    queue_ = {};
+    workers.swap(workers_);
+  }
+  wake_.notify_all();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+bool TaskQueue::Submit(Task task, TaskPriority priority,
+                       CancellationTokenPtr token) {
+  {
+    std::lock_guard lock(lock_);
+    if (!running_) {
+      return false;
+    }
+    queue_.push(Entry{priority, nextSequence_++, std::move(task),
+                      std::move(token)});
+  }
+  submitted_.fetch_add(1, std::memory_order_relaxed);
+  wake_.notify_one();
+  return true;
+}
+
+void TaskQueue::WorkerLoop() {
+  for (;;) {
+    Entry entry;
+    {
+      std::unique_lock lock(lock_);
+      wake_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+      if (!running_) {
+        return;
+      }
+      entry = queue_.top();
+      queue_.pop();
+    }
+
+    if (entry.token && entry.token->IsCancelled()) {
+      cancelled_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    entry.task();
+    completed_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+TaskQueue::Stats TaskQueue::GetStats() const {
+  Stats stats;
+  stats.submitted = submitted_.load(std::memory_order_relaxed);
+  stats.completed = completed_.load(std::memory_order_relaxed);
+  stats.cancelled = cancelled_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace Easy2Read
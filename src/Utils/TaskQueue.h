@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Easy2Read {
+
+/**
+ * Shared flag that lets the submitter abandon queued or running work.
+ * Tasks check it before they start and may poll it while running.
+ */
+class CancellationToken {
+public:
+  void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+  [[nodiscard]] bool IsCancelled() const {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<bool> cancelled_{false};
+};
+
+using CancellationTokenPtr = std::shared_ptr<CancellationToken>;
+
+enum class TaskPriority : std::uint8_t { Low, Normal, High };
+
+/**
+ * Small pool of background workers for speculative text processing.
+ * Work is taken highest priority first, then in submission order. Tasks must
+ * not touch game state that can change under them; they get copies of what
+ * they need from the submitting thread.
+ */
+class TaskQueue {
+public:
+  using Task = std::function<void()>;
+
+  struct Stats {
+    std::uint64_t submitted = 0;
+    std::uint64_t completed = 0;
+    std::uint64_t cancelled = 0; // Skipped because their token was cancelled
+  };
+
+  [[nodiscard]] static TaskQueue *GetSingleton();
+
+  /**
+   * Start the worker threads (no-op if already running).
+   * @param threadCount Number of workers, or 0 to size from the CPU count
+   */
+  void Start(std::size_t threadCount = 0);
+
+  // Drop pending tasks and join the workers
+  void Shutdown();
+
+  /**
+   * Queue a task.
+   * @param task Work to run on a worker thread
+   * @param priority Higher priority tasks run first
+   * @param token Optional token; the task is skipped if it is cancelled
+   * @return false if the queue is not running
+   */
+  bool Submit(Task task, TaskPriority priority = TaskPriority::Normal,
+              CancellationTokenPtr token = nullptr);
+
+  [[nodiscard]] Stats GetStats() const;
+
+private:
+  TaskQueue() = default;
+  ~TaskQueue();
+  TaskQueue(const TaskQueue &) = delete;
+  TaskQueue(TaskQueue &&) = delete;
+  TaskQueue &operator=(const TaskQueue &) = delete;
+  TaskQueue &operator=(TaskQueue &&) = delete;
+
+  struct Entry {
+    TaskPriority priority;
+    std::uint64_t sequence;
+    Task task;
+    CancellationTokenPtr token;
+
+    // Ordering for std::priority_queue (top = highest priority, oldest)
+    bool operator<(const Entry &other) const {
+      if (priority != other.priority) {
+        return priority < other.priority;
+      }
+      return sequence > other.sequence;
+    }
+  };
+
+  void WorkerLoop();
+
+  std::mutex lock_;
+  std::condition_variable wake_;
+  std::priority_queue<Entry> queue_;
+  std::vector<std::thread> workers_;
+  std::uint64_t nextSequence_ = 0;
+  bool running_ = false;
+
+  std::atomic<std::uint64_t> submitted_{0};
+  std::atomic<std::uint64_t> completed_{0};
+  std::atomic<std::uint64_t> cancelled_{0};
+};
+
+} // namespace Easy2Read
@@ -1,13 +1,33 @@
+#include "API/PluginAPI.h"
 #include "Config/Settings.h"
+#include "Hooks/BookPrefetch.h"
+#include "Hooks/ConsoleCommands.h"
 #include "Hooks/D3D11Hook.h"
+#include "Hooks/DescriptionCache.h"
+#include "Hooks/DialoguePrefetch.h"
+#include "Hooks/HookProfiler.h"
+#include "Hooks/HookRegistry.h"
 #include "Hooks/InputHandler.h"
+#include "Hooks/JournalProfiler.h"
 #include "Hooks/MenuControlsHook.h"
 #include "Hooks/MenuWatcher.h"
+#include "Hooks/NameTable.h"
+#include "Hooks/QuitHook.h"
 #include "Hooks/TextHooks.h"
 #include "PCH.h"
+#include "TextSanitization/AuditReport.h"
+#include "TextSanitization/CaptureWriter.h"
+#include "TextSanitization/CleanTextCache.h"
+#include "TextSanitization/PersistentCache.h"
+#include "TextSanitization/SanitizedTextCache.h"
+#include "TextSanitization/StringPool.h"
 #include "TextSanitization/TextSanitizer.h"
 #include "UI/Overlay.h"
+#include "Utils/BookCache.h"
+#include "Utils/BookLibrary.h"
+#include "Utils/Hash.h"
 #include "Utils/ImageMappings.h"
+#include "Utils/TaskQueue.h"
 
 namespace {
 /**
@@ -35,6 +55,109 @@ void SetupLog() {
                SKSE::PluginDeclaration::GetSingleton()->GetVersion().string());
 }
 
+/**
+ * Write runtime statistics (memory use, cache efficiency) to the log.
+ * Called when the game quits; saves only log the string pool's line.
+ */
+void LogRuntimeStats() {
+  Easy2Read::TextSanitizer::GetSingleton()->LogStats();
+  Easy2Read::StringPool::GetSingleton()->LogStats();
+  Easy2Read::DescriptionCache::GetSingleton()->LogStats();
+  Easy2Read::CleanTextCache::GetSingleton()->LogStats();
+  Easy2Read::SanitizedTextCache::GetSingleton()->LogStats();
+  Easy2Read::DialoguePrefetch::GetSingleton()->LogStats();
+  Easy2Read::JournalProfiler::GetSingleton()->LogStats();
+  Easy2Read::PersistentCache::GetSingleton()->LogStats();
+  Easy2Read::BookCache::GetSingleton()->LogStats();
+  Easy2Read::BookLibrary::GetSingleton()->LogStats();
+  Easy2Read::BookPrefetch::GetSingleton()->LogStats();
+  Easy2Read::MenuWatcher::GetSingleton()->LogStats();
+  for (const auto &line : Easy2Read::HookRegistry::GetSingleton()->Report()) {
+    logger::info("HookRegistry: {}", line);
+  }
+}
+
+/**
+ * Open the cross-session sanitizer cache. Cached results are only valid for
+ * the same plugins in the same order and the same sanitizer configuration.
+ */
+void OpenPersistentCache() {
+  auto *sanitizer = Easy2Read::TextSanitizer::GetSingleton();
+  if (!Easy2Read::Settings::GetSingleton()->sanitizationPersistentCache ||
+      sanitizer->GetMode() != Easy2Read::SanitizationMode::AnyASCII) {
+    return;
+  }
+
+  std::uint64_t fingerprint = sanitizer->GetConfigFingerprint();
+  if (auto *dataHandler = RE::TESDataHandler::GetSingleton()) {
+    for (const auto *file : dataHandler->files) {
+      if (file) {
+        fingerprint = Easy2Read::HashCombine(
+            fingerprint, Easy2Read::HashText(file->GetFilename()));
+      }
+    }
+  }
+  Easy2Read::PersistentCache::GetSingleton()->Open(
+      "Data/SKSE/Plugins/Easy2Read", fingerprint);
+}
+
+/**
+ * Flush background writers and log final statistics when the game quits.
+ * Runs from QuitHook while every thread and singleton is still alive.
+ */
+void OnShutdown() {
+  Easy2Read::TaskQueue::GetSingleton()->Shutdown();
+  Easy2Read::BookLibrary::GetSingleton()->Shutdown();
+  Easy2Read::AuditReport::GetSingleton()->Shutdown();
+  Easy2Read::CaptureWriter::GetSingleton()->Shutdown();
+  LogRuntimeStats();
+  Easy2Read::PersistentCache::GetSingleton()->Close();
+  if (Easy2Read::HookProfiler::GetSingleton()->IsEnabled()) {
+    Easy2Read::HookProfiler::GetSingleton()->LogReport();
+  }
+}
+
+/**
+ * Configure the text sanitizer from settings.
+ * Runs at plugin load so other plugins using the API see the final
+ * configuration before game data is loaded.
+ */
+void ConfigureSanitizer() {
+  auto *settings = Easy2Read::Settings::GetSingleton();
+  auto *sanitizer = Easy2Read::TextSanitizer::GetSingleton();
+  sanitizer->SetEnabled(settings->sanitizationEnabled);
+  sanitizer->SetLogReplacements(settings->sanitizationLogReplacements);
+  sanitizer->SetMaxExpansionRatio(settings->sanitizationMaxExpansionRatio);
+  sanitizer->SetDebugMode(settings->sanitizationDebugMode);
+  sanitizer->SetLatin1ToUTF8(settings->sanitizationLatin1ToUTF8);
+  Easy2Read::HookProfiler::GetSingleton()->SetSampleRate(
+      settings->sanitizationProfileSampleRate);
+  if (settings->sanitizationEnabled && settings->sanitizationCapture) {
+    if (auto logsFolder = SKSE::log::log_directory()) {
+      Easy2Read::CaptureWriter::GetSingleton()->Initialize(
+          *logsFolder / "Easy2Read_Capture.e2rcap");
+    }
+  }
+
+  // Parse mode string
+  if (settings->sanitizationMode == "Off") {
+    sanitizer->SetMode(Easy2Read::SanitizationMode::Off);
+  } else if (settings->sanitizationMode == "DetectOnly") {
+    sanitizer->SetMode(Easy2Read::SanitizationMode::DetectOnly);
+    if (settings->sanitizationEnabled && settings->sanitizationAuditReport) {
+      if (auto logsFolder = SKSE::log::log_directory()) {
+        Easy2Read::AuditReport::GetSingleton()->Initialize(
+            *logsFolder / "Easy2Read_Audit.csv");
+      }
+    }
+  } else {
+    sanitizer->SetMode(Easy2Read::SanitizationMode::AnyASCII);
+  }
+
+  // Per-hook policies from the Enable...Hook keys (applied when installed)
+  Easy2Read::HookRegistry::GetSingleton()->LoadFromSettings();
+}
+
 /**
  * Handle SKSE messages (game lifecycle events).
  */
@@ -46,40 +169,37 @@ void MessageHandler(SKSE::MessagingInterface::Message *a_msg) {
     // Load image-to-text mappings
     Easy2Read::ImageMappings::GetSingleton()->LoadMappings();
 
-    // Configure text sanitizer from settings
-    {
-      auto *settings = Easy2Read::Settings::GetSingleton();
-      auto *sanitizer = Easy2Read::TextSanitizer::GetSingleton();
-      sanitizer->SetEnabled(settings->sanitizationEnabled);
-      sanitizer->SetLogReplacements(settings->sanitizationLogReplacements);
-      sanitizer->SetMaxExpansionRatio(settings->sanitizationMaxExpansionRatio);
-      sanitizer->SetDebugMode(settings->sanitizationDebugMode);
-
-      // Parse mode string
-      if (settings->sanitizationMode == "Off") {
-        sanitizer->SetMode(Easy2Read::SanitizationMode::Off);
-      } else if (settings->sanitizationMode == "DetectOnly") {
-        sanitizer->SetMode(Easy2Read::SanitizationMode::DetectOnly);
-      } else {
-        sanitizer->SetMode(Easy2Read::SanitizationMode::AnyASCII);
-      }
-
-      // Configure per-hook enable settings
-      Easy2Read::HookSettings hooks;
-      hooks.enableDescription = settings->hookEnableDescription;
-      hooks.enableDialogue = settings->hookEnableDialogue;
-      hooks.enableDialogueMenu = settings->hookEnableDialogueMenu;
-      hooks.enableQuest = settings->hookEnableQuest;
-      hooks.enableMapMarker = settings->hookEnableMapMarker;
-      hooks.enableNpcName = settings->hookEnableNpcName;
-      sanitizer->SetHookSettings(hooks);
-    }
+    // Background workers for speculative text processing
+    Easy2Read::TaskQueue::GetSingleton()->Start();
 
     // Install text sanitization hooks for global coverage
     if (Easy2Read::Settings::GetSingleton()->sanitizationEnabled) {
       // Allocate trampoline space for hooks (256 bytes should be plenty)
       SKSE::AllocTrampoline(256);
+      OpenPersistentCache();
       Easy2Read::TextHooks::Install();
+
+      // NPC and map marker names can't be replaced per call; rewrite them once
+      Easy2Read::NameTable::Apply();
+
+      // Sanitize dialogue menu topics before the menu asks for them
+      Easy2Read::DialoguePrefetch::GetSingleton()->Register();
+    }
+
+    // e2r console command (profiling and diagnostics)
+    Easy2Read::ConsoleCommands::Install();
+
+    // Processed books are kept up to the configured size
+    Easy2Read::BookCache::GetSingleton()->SetBudget(
+        static_cast<std::size_t>(
+            Easy2Read::Settings::GetSingleton()->bookCacheSizeMB) *
+        1024 * 1024);
+    if (Easy2Read::Settings::GetSingleton()->bookPrefetch) {
+      Easy2Read::BookPrefetch::GetSingleton()->Register();
+    }
+    // Needs the image mappings and the sanitizer settings loaded above
+    if (Easy2Read::Settings::GetSingleton()->precompileBooks) {
+      Easy2Read::BookLibrary::GetSingleton()->Build();
     }
 
     // Register event handlers
@@ -95,11 +215,23 @@ void MessageHandler(SKSE::MessagingInterface::Message *a_msg) {
           []() { Easy2Read::Overlay::GetSingleton()->Render(); });
     }
     break;
+  case SKSE::MessagingInterface::kSaveGame:
+    Easy2Read::AuditReport::GetSingleton()->Flush();
+    Easy2Read::TaskQueue::GetSingleton()->Submit(
+        [] { Easy2Read::PersistentCache::GetSingleton()->Flush(); },
+        Easy2Read::TaskPriority::Low);
+    // One line per save (autosaves included); the full report is written
+    // when the game quits
+    Easy2Read::StringPool::GetSingleton()->LogStats();
+    break;
   case SKSE::MessagingInterface::kPostLoad:
     logger::info("Post load complete");
     break;
   case SKSE::MessagingInterface::kPostPostLoad:
     logger::info("Post-post load complete");
+
+    // All plugins are loaded: hand the sanitizer API to listeners
+    Easy2Read::PluginAPI::Broadcast();
     break;
   default:
     break;
@@ -118,6 +250,7 @@ SKSEPluginLoad(const SKSE::LoadInterface *a_skse) {
 
   // Load configuration from INI
   Easy2Read::Settings::GetSingleton()->Load();
+  ConfigureSanitizer();
 
   // Get SKSE messaging interface for lifecycle events
   auto messaging = SKSE::GetMessagingInterface();
@@ -128,6 +261,9 @@ SKSEPluginLoad(const SKSE::LoadInterface *a_skse) {
 
   messaging->RegisterListener(MessageHandler);
 
+  // Final report and statistics when the game quits
+  Easy2Read::QuitHook::Install(OnShutdown);
+
   logger::info("Easy2Read initialization complete");
   return true;
 }
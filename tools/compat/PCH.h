@@ -0,0 +1,64 @@
+#pragma once
+
+// Stand-in for src/PCH.h when building the RE-independent plugin sources
+// (TextSanitization, Utils) into desktop tools. Provides the standard headers
+// the real PCH pulls in and routes SKSE::log to stderr.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace SKSE::log {
+namespace detail {
+inline bool &Verbose() {
+  static bool verbose = false;
+  return verbose;
+}
+} // namespace detail
+
+// Show debug output (off by default so tool timing isn't skewed)
+inline void SetVerbose(bool verbose) { detail::Verbose() = verbose; }
+
+template <class... Args>
+void info(fmt::format_string<Args...> format, Args &&...args) {
+  if (detail::Verbose()) {
+    fmt::print(stderr, "{}\n", fmt::format(format, std::forward<Args>(args)...));
+  }
+}
+
+template <class... Args>
+void debug(fmt::format_string<Args...> format, Args &&...args) {
+  if (detail::Verbose()) {
+    fmt::print(stderr, "{}\n", fmt::format(format, std::forward<Args>(args)...));
+  }
+}
+
+template <class... Args>
+void warn(fmt::format_string<Args...> format, Args &&...args) {
+  fmt::print(stderr, "warning: {}\n",
+             fmt::format(format, std::forward<Args>(args)...));
+}
+
+template <class... Args>
+void error(fmt::format_string<Args...> format, Args &&...args) {
+  fmt::print(stderr, "error: {}\n",
+             fmt::format(format, std::forward<Args>(args)...));
+}
+} // namespace SKSE::log
+
+namespace logger = SKSE::log;
+
+using namespace std::literals;
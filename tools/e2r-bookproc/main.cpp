@@ -0,0 +1,719 @@
+// e2r-bookproc: run book texts through the plugin's book pipeline outside the
+// game, write the results to files and report per-stage timing and heap
+// allocations.
+//
+//   e2r-bookproc <dir|file.jsonl> [--out DIR] [--images DIR] [--threads N]
+//                [--repeat N] [--document] [--no-sanitize] [--latin1-utf8]
+//                [--verbose]
+//
+// A directory is searched recursively for .txt files; each file is one book,
+// titled by its file name. A JSONL dump holds one object per line with
+// "text" and optional "title" and "id" (e.g. a FormID) string fields.
+//
+// The pipeline stages run fused in one streaming pass, so a stage can't be
+// timed on its own. Each book is instead run three times, each run stopping
+// after a later stage: markup only, then with the whitespace, title and
+// byline cleanup, then with the sanitizer. The report shows each run's time
+// and what the added stage cost on top of the previous run. An untimed pass
+// over all books comes first, so no run pays for cold caches the next one
+// finds warm; a difference lost in timing noise is shown as zero.
+
+#include "PCH.h"
+#include "TextSanitization/TextSanitizer.h"
+#include "Utils/BookDocument.h"
+#include "Utils/BookPipeline.h"
+#include "Utils/ImagePath.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <thread>
+
+// ---- Allocation counting (per thread, so workers don't see each other) ----
+namespace {
+thread_local std::uint64_t t_allocations = 0;
+thread_local std::uint64_t t_allocatedBytes = 0;
+} // namespace
+
+void *operator new(std::size_t size) {
+  ++t_allocations;
+  t_allocatedBytes += size;
+  if (void *p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+using Easy2Read::BookDocument;
+using Easy2Read::BookPipeline;
+using Easy2Read::ImagePath;
+using Easy2Read::TextSanitizer;
+using Clock = std::chrono::steady_clock;
+namespace fs = std::filesystem;
+
+struct Options {
+  std::string inputPath;
+  std::string outputDir;
+  std::string imagesDir;
+  unsigned threads = 0; // 0 = all cores
+  int repeat = 1;
+  bool document = false;
+  bool sanitize = true;
+  bool latin1ToUtf8 = false;
+};
+
+struct Book {
+  std::string name; // Output file name, without extension
+  std::string title;
+  std::string raw;
+};
+
+enum Stage : std::size_t { kMarkup, kCleanup, kSanitize, kDocument, kStages };
+
+constexpr const char *kStageLabels[kStages] = {
+    "markup", "+ cleanup", "+ sanitize", "document"};
+
+struct StageTotals {
+  std::uint64_t ns = 0;
+  std::uint64_t allocations = 0;
+  std::uint64_t allocatedBytes = 0;
+};
+
+// Everything one worker measured; merged after the run
+struct WorkerResults {
+  StageTotals stages[kStages];
+  std::vector<std::uint64_t> bookNs; // Full pipeline time of each book run
+  std::uint64_t bytesIn = 0;
+  std::uint64_t bytesOut = 0;
+  std::uint64_t writeErrors = 0;
+};
+
+void PrintUsage() {
+  std::fprintf(stderr,
+               "usage: e2r-bookproc <dir|file.jsonl> [--out DIR] "
+               "[--images DIR] [--threads N] [--repeat N] [--document] "
+               "[--no-sanitize] [--latin1-utf8] [--verbose]\n");
+}
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg == "--out" && i + 1 < argc) {
+      options.outputDir = argv[++i];
+    } else if (arg == "--images" && i + 1 < argc) {
+      options.imagesDir = argv[++i];
+    } else if (arg == "--threads" && i + 1 < argc) {
+      options.threads =
+          static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+    } else if (arg == "--repeat" && i + 1 < argc) {
+      options.repeat = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--document") {
+      options.document = true;
+    } else if (arg == "--no-sanitize") {
+      options.sanitize = false;
+    } else if (arg == "--latin1-utf8") {
+      options.latin1ToUtf8 = true;
+    } else if (arg == "--verbose") {
+      SKSE::log::SetVerbose(true);
+    } else if (!arg.starts_with("--") && options.inputPath.empty()) {
+      options.inputPath = arg;
+    } else {
+      return false;
+    }
+  }
+  return !options.inputPath.empty();
+}
+
+bool ReadFile(const fs::path &path, std::string &contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream stream;
+  stream << file.rdbuf();
+  contents = std::move(stream).str();
+  return true;
+}
+
+std::string_view TrimSpaces(std::string_view text) {
+  const auto begin = text.find_first_not_of(" \t\r\n");
+  if (begin == std::string_view::npos) {
+    return {};
+  }
+  const auto end = text.find_last_not_of(" \t\r\n");
+  return text.substr(begin, end - begin + 1);
+}
+
+// ---- Image mappings ----
+
+// Matched like the plugin's ImageMappings (see ImagePath), read without
+// SimpleIni: "path = replacement" lines under [Mappings]
+class ImageTable {
+public:
+  bool Load(const fs::path &dir) {
+    std::error_code ec;
+    for (const auto &entry : fs::directory_iterator(dir, ec)) {
+      auto ext = entry.path().extension().string();
+      std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+      if (entry.is_regular_file() && (ext == ".ini" || ext == ".txt")) {
+        LoadFile(entry.path());
+      }
+    }
+    if (ec) {
+      std::fprintf(stderr, "cannot read %s\n", dir.string().c_str());
+      return false;
+    }
+    return true;
+  }
+
+  [[nodiscard]] std::size_t Size() const { return mappings_.size(); }
+
+  // Workers only read the map, so lookups are safe from every thread
+  [[nodiscard]] std::string_view Lookup(std::string_view path) const {
+    const auto it = mappings_.find(path);
+    return it != mappings_.end() ? std::string_view(it->second)
+                                 : std::string_view{};
+  }
+
+private:
+  void LoadFile(const fs::path &path) {
+    std::string contents;
+    if (!ReadFile(path, contents)) {
+      SKSE::log::warn("Failed to load mapping file: {}", path.string());
+      return;
+    }
+    std::istringstream lines(contents);
+    std::string line;
+    bool inMappings = false;
+    while (std::getline(lines, line)) {
+      const auto text = TrimSpaces(line);
+      if (text.empty() || text.front() == ';' || text.front() == '#') {
+        continue;
+      }
+      if (text.front() == '[') {
+        inMappings = text == "[Mappings]";
+        continue;
+      }
+      const auto equals = text.find('=');
+      if (!inMappings || equals == std::string_view::npos) {
+        continue;
+      }
+      const auto key = TrimSpaces(text.substr(0, equals));
+      const auto value = TrimSpaces(text.substr(equals + 1));
+      if (!key.empty() && !value.empty()) {
+        mappings_.insert_or_assign(std::string(key), std::string(value));
+      }
+    }
+  }
+
+  std::unordered_map<std::string, std::string, ImagePath::Hash,
+                     ImagePath::Equal>
+      mappings_;
+};
+
+// ---- Input ----
+
+// File names from titles or ids: keep it portable
+std::string MakeFileName(std::string_view text) {
+  std::string name;
+  for (const char c : text.substr(0, 80)) {
+    const bool safe = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                      (c >= '0' && c <= '9') || c == '-' || c == '_';
+    name.push_back(safe ? c : '_');
+  }
+  return name;
+}
+
+void AppendUtf8(std::string &out, std::uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    out.push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+// Minimal reader for the flat JSONL objects this tool takes: string values
+// are decoded, any other value is skipped
+class JsonLine {
+public:
+  explicit JsonLine(std::string_view line) : line_(line) {}
+
+  // Calls onField(key, value) for each string field; false if malformed
+  template <class OnField> bool Parse(OnField &&onField) {
+    SkipSpaces();
+    if (!Consume('{')) {
+      return false;
+    }
+    SkipSpaces();
+    if (Consume('}')) {
+      return true;
+    }
+    std::string key;
+    std::string value;
+    while (true) {
+      SkipSpaces();
+      if (!ReadString(key)) {
+        return false;
+      }
+      SkipSpaces();
+      if (!Consume(':')) {
+        return false;
+      }
+      SkipSpaces();
+      if (pos_ < line_.size() && line_[pos_] == '"') {
+        if (!ReadString(value)) {
+          return false;
+        }
+        onField(key, value);
+      } else if (!SkipValue()) {
+        return false;
+      }
+      SkipSpaces();
+      if (Consume('}')) {
+        return true;
+      }
+      if (!Consume(',')) {
+        return false;
+      }
+    }
+  }
+
+private:
+  void SkipSpaces() {
+    while (pos_ < line_.size() &&
+           (line_[pos_] == ' ' || line_[pos_] == '\t' || line_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  bool Consume(char c) {
+    if (pos_ < line_.size() && line_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool ReadHex4(std::uint32_t &value) {
+    if (pos_ + 4 > line_.size()) {
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = line_[pos_++];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= static_cast<std::uint32_t>(c - '0');
+      } else if (c >= 'a' && c <= 'f') {
+        value |= static_cast<std::uint32_t>(c - 'a' + 10);
+      } else if (c >= 'A' && c <= 'F') {
+        value |= static_cast<std::uint32_t>(c - 'A' + 10);
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool ReadString(std::string &out) {
+    out.clear();
+    if (!Consume('"')) {
+      return false;
+    }
+    while (pos_ < line_.size()) {
+      const char c = line_[pos_++];
+      if (c == '"') {
+        return true;
+      }
+      if (c != '\\') {
+        out.push_back(c);
+        continue;
+      }
+      if (pos_ >= line_.size()) {
+        return false;
+      }
+      switch (const char escape = line_[pos_++]) {
+      case 'n':
+        out.push_back('\n');
+        break;
+      case 't':
+        out.push_back('\t');
+        break;
+      case 'r':
+        out.push_back('\r');
+        break;
+      case 'b':
+        out.push_back('\b');
+        break;
+      case 'f':
+        out.push_back('\f');
+        break;
+      case 'u': {
+        std::uint32_t codepoint = 0;
+        if (!ReadHex4(codepoint)) {
+          return false;
+        }
+        // Surrogate pair
+        if (codepoint >= 0xD800 && codepoint < 0xDC00 &&
+            line_.substr(pos_, 2) == "\\u") {
+          pos_ += 2;
+          std::uint32_t low = 0;
+          if (!ReadHex4(low) || low < 0xDC00 || low >= 0xE000) {
+            return false;
+          }
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        AppendUtf8(out, codepoint);
+        break;
+      }
+      default: // '"', '\\', '/'
+        out.push_back(escape);
+        break;
+      }
+    }
+    return false;
+  }
+
+  // Numbers, literals and nested values (strings inside are skipped whole)
+  bool SkipValue() {
+    int depth = 0;
+    std::string ignored;
+    while (pos_ < line_.size()) {
+      const char c = line_[pos_];
+      if (c == '"') {
+        if (!ReadString(ignored)) {
+          return false;
+        }
+        continue;
+      }
+      if (depth == 0 && (c == ',' || c == '}')) {
+        return true;
+      }
+      if (c == '{' || c == '[') {
+        ++depth;
+      } else if (c == '}' || c == ']') {
+        --depth;
+      }
+      ++pos_;
+    }
+    return false;
+  }
+
+  std::string_view line_;
+  std::size_t pos_ = 0;
+};
+
+bool LoadJsonl(const fs::path &path, std::vector<Book> &books) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    std::fprintf(stderr, "cannot open %s\n", path.string().c_str());
+    return false;
+  }
+  std::string line;
+  std::size_t lineNumber = 0;
+  while (std::getline(file, line)) {
+    ++lineNumber;
+    if (TrimSpaces(line).empty()) {
+      continue;
+    }
+    Book book;
+    std::string id;
+    bool hasText = false;
+    const bool parsed = JsonLine(line).Parse(
+        [&](const std::string &key, const std::string &value) {
+          if (key == "text") {
+            book.raw = value;
+            hasText = true;
+          } else if (key == "title") {
+            book.title = value;
+          } else if (key == "id") {
+            id = value;
+          }
+        });
+    if (!parsed || !hasText) {
+      std::fprintf(stderr, "%s:%zu: expected an object with a \"text\" field\n",
+                   path.string().c_str(), lineNumber);
+      continue;
+    }
+    // Line numbers keep names unique when ids or titles repeat
+    book.name = fmt::format("{:06}_{}", lineNumber,
+                            MakeFileName(!id.empty() ? id : book.title));
+    books.push_back(std::move(book));
+  }
+  return true;
+}
+
+bool LoadDirectory(const fs::path &dir, std::vector<Book> &books) {
+  std::error_code ec;
+  for (auto it = fs::recursive_directory_iterator(dir, ec);
+       !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+    if (!it->is_regular_file() || it->path().extension() != ".txt") {
+      continue;
+    }
+    Book book;
+    if (!ReadFile(it->path(), book.raw)) {
+      std::fprintf(stderr, "cannot read %s\n", it->path().string().c_str());
+      continue;
+    }
+    book.title = it->path().stem().string();
+    // Keep the input tree's layout in the output directory
+    book.name = fs::relative(it->path(), dir).replace_extension().string();
+    books.push_back(std::move(book));
+  }
+  if (ec) {
+    std::fprintf(stderr, "cannot read %s\n", dir.string().c_str());
+    return false;
+  }
+  // Directory order isn't stable between runs
+  std::sort(books.begin(), books.end(),
+            [](const Book &a, const Book &b) { return a.name < b.name; });
+  return true;
+}
+
+bool WriteOutput(const fs::path &path, std::string_view text) {
+  std::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+  std::ofstream file(path, std::ios::binary);
+  file.write(text.data(), static_cast<std::streamsize>(text.size()));
+  return static_cast<bool>(file);
+}
+
+// ---- Processing ----
+
+std::uint64_t ElapsedNs(Clock::time_point start) {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                           start)
+          .count());
+}
+
+// Time one run of a stage and add its allocations
+template <class Run> std::uint64_t Measure(StageTotals &totals, Run &&run) {
+  const auto allocsBefore = t_allocations;
+  const auto bytesBefore = t_allocatedBytes;
+  const auto start = Clock::now();
+  run();
+  const auto elapsed = ElapsedNs(start);
+  totals.ns += elapsed;
+  totals.allocations += t_allocations - allocsBefore;
+  totals.allocatedBytes += t_allocatedBytes - bytesBefore;
+  return elapsed;
+}
+
+void ProcessBooks(const std::vector<Book> &books, const Options &options,
+                  const BookPipeline::ImageLookup &imageLookup,
+                  std::atomic<std::size_t> &next, WorkerResults &results) {
+  auto *sanitizer = TextSanitizer::GetSingleton();
+
+  // Reused across books like the plugin reuses its output buffer; the
+  // document is rebuilt each time since the plugin caches every document
+  std::string output;
+  std::string markup;
+  const std::size_t total = books.size() * options.repeat;
+
+  for (std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+       index < total; index = next.fetch_add(1, std::memory_order_relaxed)) {
+    const bool lastPass = index + books.size() >= total;
+    const Book &book = books[index % books.size()];
+
+    BookPipeline::Options pipeline;
+    pipeline.title = book.title;
+    pipeline.imageLookup = imageLookup;
+
+    Measure(results.stages[kMarkup], [&] {
+      markup = BookPipeline::StripMarkup(book.raw, imageLookup);
+    });
+    std::uint64_t bookNs = Measure(results.stages[kCleanup], [&] {
+      BookPipeline::Process(book.raw, pipeline, output);
+    });
+    if (options.sanitize) {
+      pipeline.sanitizer = sanitizer;
+      bookNs = Measure(results.stages[kSanitize], [&] {
+        BookPipeline::Process(book.raw, pipeline, output);
+      });
+    }
+
+    if (options.document) {
+      Measure(results.stages[kDocument], [&] {
+        BookDocument document;
+        BookPipeline::Process(book.raw, pipeline, document);
+      });
+    }
+
+    results.bookNs.push_back(bookNs);
+    results.bytesIn += book.raw.size();
+    results.bytesOut += output.size();
+
+    if (lastPass && !options.outputDir.empty() &&
+        !WriteOutput(fs::path(options.outputDir) / (book.name + ".txt"),
+                     output)) {
+      ++results.writeErrors;
+    }
+  }
+}
+
+std::uint64_t Percentile(std::vector<std::uint64_t> &values, double fraction) {
+  if (values.empty()) {
+    return 0;
+  }
+  const auto index =
+      static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    PrintUsage();
+    return 2;
+  }
+
+  std::vector<Book> books;
+  const fs::path input(options.inputPath);
+  const bool loaded = fs::is_directory(input) ? LoadDirectory(input, books)
+                                              : LoadJsonl(input, books);
+  if (!loaded) {
+    return 1;
+  }
+  if (books.empty()) {
+    std::fprintf(stderr, "no books found in %s\n", options.inputPath.c_str());
+    return 1;
+  }
+
+  ImageTable images;
+  BookPipeline::ImageLookup imageLookup;
+  if (!options.imagesDir.empty()) {
+    if (!images.Load(options.imagesDir)) {
+      return 1;
+    }
+    imageLookup = [&images](std::string_view path) {
+      return images.Lookup(path);
+    };
+  }
+
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  sanitizer->SetMode(Easy2Read::SanitizationMode::AnyASCII);
+  sanitizer->SetLatin1ToUTF8(options.latin1ToUtf8);
+
+  const unsigned threadCount =
+      options.threads ? options.threads
+                      : std::max(1u, std::thread::hardware_concurrency());
+  const auto runWorkers = [&](const Options &runOptions,
+                              std::vector<WorkerResults> &runResults) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+      workers.emplace_back(ProcessBooks, std::cref(books),
+                           std::cref(runOptions), std::cref(imageLookup),
+                           std::ref(next), std::ref(runResults[i]));
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  };
+
+  // Warm-up: one untimed pass without output files
+  {
+    Options warmup = options;
+    warmup.repeat = 1;
+    warmup.outputDir.clear();
+    std::vector<WorkerResults> discarded(threadCount);
+    runWorkers(warmup, discarded);
+  }
+
+  std::vector<WorkerResults> results(threadCount);
+  const auto runStart = Clock::now();
+  runWorkers(options, results);
+  const double wallSeconds =
+      std::chrono::duration<double>(Clock::now() - runStart).count();
+
+  WorkerResults merged;
+  for (auto &result : results) {
+    for (std::size_t s = 0; s < kStages; ++s) {
+      merged.stages[s].ns += result.stages[s].ns;
+      merged.stages[s].allocations += result.stages[s].allocations;
+      merged.stages[s].allocatedBytes += result.stages[s].allocatedBytes;
+    }
+    merged.bookNs.insert(merged.bookNs.end(), result.bookNs.begin(),
+                         result.bookNs.end());
+    merged.bytesIn += result.bytesIn;
+    merged.bytesOut += result.bytesOut;
+    merged.writeErrors += result.writeErrors;
+  }
+
+  const std::uint64_t runs = merged.bookNs.size();
+  const double mbIn =
+      static_cast<double>(merged.bytesIn) / (1024.0 * 1024.0);
+  fmt::print("{}: {} books, {:.1f} MB, {} pass(es), {} thread(s), {} image "
+             "mappings\n",
+             options.inputPath, books.size(), mbIn / options.repeat,
+             options.repeat, threadCount, images.Size());
+  fmt::print("  wall: {:.3f} s, {:.1f} MB/s, {:.0f} books/s\n", wallSeconds,
+             mbIn / wallSeconds, static_cast<double>(runs) / wallSeconds);
+  fmt::print("  output: {:.1f}% of input size\n",
+             100.0 * static_cast<double>(merged.bytesOut) /
+                 static_cast<double>(merged.bytesIn));
+
+  const auto p50 = Percentile(merged.bookNs, 0.50);
+  const auto p99 = Percentile(merged.bookNs, 0.99);
+  const auto max = *std::max_element(merged.bookNs.begin(), merged.bookNs.end());
+  fmt::print("  per book: p50 {} ns, p99 {} ns, max {} ns\n", p50, p99, max);
+
+  // Cumulative runs: each stage's cost is its run minus the previous run,
+  // never below zero
+  fmt::print("  {:<11} {:>12} {:>12} {:>12} {:>14}\n", "stage", "run ms",
+             "stage ms", "allocs/book", "alloc KB/book");
+  std::uint64_t previousNs = 0;
+  for (std::size_t s = 0; s < kStages; ++s) {
+    if ((s == kSanitize && !options.sanitize) ||
+        (s == kDocument && !options.document)) {
+      continue;
+    }
+    const auto &stage = merged.stages[s];
+    const std::uint64_t stageNs =
+        s == kDocument ? stage.ns : stage.ns - (std::min)(stage.ns, previousNs);
+    const double stageMs = static_cast<double>(stageNs) / 1e6;
+    fmt::print("  {:<11} {:>12.3f} {:>12.3f} {:>12.2f} {:>14.2f}\n",
+               kStageLabels[s], static_cast<double>(stage.ns) / 1e6, stageMs,
+               static_cast<double>(stage.allocations) /
+                   static_cast<double>(runs),
+               static_cast<double>(stage.allocatedBytes) / 1024.0 /
+                   static_cast<double>(runs));
+    if (s != kDocument) {
+      previousNs = stage.ns;
+    }
+  }
+
+  if (!options.outputDir.empty()) {
+    fmt::print("  wrote {} files to {}\n", books.size() - merged.writeErrors,
+               options.outputDir);
+  }
+  if (merged.writeErrors) {
+    std::fprintf(stderr, "%llu output files could not be written\n",
+                 static_cast<unsigned long long>(merged.writeErrors));
+    return 1;
+  }
+  return 0;
+}
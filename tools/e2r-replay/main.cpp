@@ -0,0 +1,263 @@
+// e2r-replay: feed a hook traffic capture (Easy2Read_Capture.e2rcap) through
+// TextSanitizer outside the game and report throughput, latency and heap
+// allocations.
+//
+//   e2r-replay <capture> [--realtime] [--repeat N] [--detect-only]
+//              [--latin1-utf8] [--verbose]
+//
+// Each string is run the way the hooks run it: NeedsSanitization(), then an
+// in-place rewrite of a copy of the text (the copy is not timed).
+
+#include "PCH.h"
+#include "TextSanitization/CaptureFormat.h"
+#include "TextSanitization/TextSanitizer.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <thread>
+
+// ---- Allocation counting ----
+namespace {
+std::atomic<std::uint64_t> g_allocations{0};
+std::atomic<std::uint64_t> g_allocatedBytes{0};
+} // namespace
+
+void *operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+using Easy2Read::TextHook;
+using Easy2Read::TextSanitizer;
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+  std::string capturePath;
+  bool realtime = false;
+  int repeat = 1;
+  bool detectOnly = false;
+  bool latin1ToUtf8 = false;
+};
+
+struct Record {
+  std::uint64_t timestampNs;
+  std::uint32_t formID;
+  TextHook hook;
+  std::string text;
+};
+
+struct HookResults {
+  std::vector<std::uint64_t> latenciesNs;
+  std::uint64_t flagged = 0;
+  std::uint64_t bytes = 0;
+};
+
+void PrintUsage() {
+  std::fprintf(stderr,
+               "usage: e2r-replay <capture> [--realtime] [--repeat N] "
+               "[--detect-only] [--latin1-utf8] [--verbose]\n");
+}
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (arg == "--realtime") {
+      options.realtime = true;
+    } else if (arg == "--repeat" && i + 1 < argc) {
+      options.repeat = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--detect-only") {
+      options.detectOnly = true;
+    } else if (arg == "--latin1-utf8") {
+      options.latin1ToUtf8 = true;
+    } else if (arg == "--verbose") {
+      SKSE::log::SetVerbose(true);
+    } else if (!arg.starts_with("--") && options.capturePath.empty()) {
+      options.capturePath = arg;
+    } else {
+      return false;
+    }
+  }
+  return !options.capturePath.empty();
+}
+
+bool LoadCapture(const std::string &path, std::vector<Record> &records) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    std::fprintf(stderr, "cannot open %s\n", path.c_str());
+    return false;
+  }
+
+  Easy2Read::Capture::FileHeader header{};
+  file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!file ||
+      std::memcmp(header.magic, Easy2Read::Capture::kMagic,
+                  sizeof(header.magic)) != 0 ||
+      header.version != Easy2Read::Capture::kVersion) {
+    std::fprintf(stderr, "%s is not an Easy2Read capture (v%u)\n",
+                 path.c_str(), Easy2Read::Capture::kVersion);
+    return false;
+  }
+
+  Easy2Read::Capture::RecordHeader recordHeader{};
+  while (file.read(reinterpret_cast<char *>(&recordHeader),
+                   sizeof(recordHeader))) {
+    if (recordHeader.hook >= static_cast<std::uint8_t>(TextHook::kTotal)) {
+      std::fprintf(stderr, "corrupt record at offset %lld\n",
+                   static_cast<long long>(file.tellg()));
+      return false;
+    }
+    Record record{recordHeader.timestampNs, recordHeader.formID,
+                  static_cast<TextHook>(recordHeader.hook),
+                  std::string(recordHeader.length, '\0')};
+    if (!file.read(record.text.data(), recordHeader.length)) {
+      std::fprintf(stderr, "capture truncated (last record incomplete)\n");
+      break;
+    }
+    records.push_back(std::move(record));
+  }
+  return true;
+}
+
+std::uint64_t Percentile(std::vector<std::uint64_t> &values, double fraction) {
+  if (values.empty()) {
+    return 0;
+  }
+  const auto index =
+      static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    PrintUsage();
+    return 2;
+  }
+
+  std::vector<Record> records;
+  if (!LoadCapture(options.capturePath, records)) {
+    return 1;
+  }
+  if (records.empty()) {
+    std::fprintf(stderr, "capture is empty\n");
+    return 1;
+  }
+
+  auto *sanitizer = TextSanitizer::GetSingleton();
+  sanitizer->SetMode(options.detectOnly
+                         ? Easy2Read::SanitizationMode::DetectOnly
+                         : Easy2Read::SanitizationMode::AnyASCII);
+  sanitizer->SetLatin1ToUTF8(options.latin1ToUtf8);
+
+  // Working buffers, sized up front so the timed region allocates only what
+  // the sanitizer itself allocates
+  std::size_t longest = 0;
+  for (const auto &record : records) {
+    longest = std::max(longest, record.text.size());
+  }
+  std::vector<char> buffer(longest + 1);
+  std::string overflow;
+  overflow.reserve(longest * 4);
+
+  std::array<HookResults, static_cast<std::size_t>(TextHook::kTotal)> results;
+  for (auto &result : results) {
+    result.latenciesNs.reserve(records.size() * options.repeat);
+  }
+
+  std::uint64_t totalBytes = 0;
+  std::uint64_t busyNs = 0;
+  std::uint64_t allocations = 0;
+  std::uint64_t allocatedBytes = 0;
+  const auto runStart = Clock::now();
+
+  for (int pass = 0; pass < options.repeat; ++pass) {
+    const auto passStart = Clock::now();
+    for (const auto &record : records) {
+      if (options.realtime) {
+        std::this_thread::sleep_until(
+            passStart + std::chrono::nanoseconds(record.timestampNs));
+      }
+
+      std::memcpy(buffer.data(), record.text.data(), record.text.size());
+      buffer[record.text.size()] = '\0';
+
+      const auto allocsBefore = g_allocations.load(std::memory_order_relaxed);
+      const auto bytesBefore = g_allocatedBytes.load(std::memory_order_relaxed);
+      const auto start = Clock::now();
+
+      const std::string_view text(buffer.data(), record.text.size());
+      const bool flagged = sanitizer->NeedsSanitization(text);
+      if (flagged && !options.detectOnly) {
+        (void)sanitizer->SanitizeInPlace(buffer.data(), record.text.size(),
+                                         record.text.size(), overflow);
+      }
+
+      const auto elapsed = static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                               start)
+              .count());
+      allocations += g_allocations.load(std::memory_order_relaxed) - allocsBefore;
+      allocatedBytes +=
+          g_allocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+
+      auto &result = results[static_cast<std::size_t>(record.hook)];
+      result.latenciesNs.push_back(elapsed);
+      result.flagged += flagged ? 1 : 0;
+      result.bytes += record.text.size();
+      totalBytes += record.text.size();
+      busyNs += elapsed;
+    }
+  }
+
+  const double wallSeconds =
+      std::chrono::duration<double>(Clock::now() - runStart).count();
+  const double busySeconds = static_cast<double>(busyNs) / 1e9;
+  const std::uint64_t calls = records.size() * options.repeat;
+
+  fmt::print("{}: {} strings, {:.1f} KB, {} pass(es){}\n",
+             options.capturePath, records.size(),
+             static_cast<double>(totalBytes) / options.repeat / 1024.0,
+             options.repeat, options.realtime ? ", original timing" : "");
+  fmt::print("  time in sanitizer: {:.3f} ms ({:.1f}% of {:.3f} s wall)\n",
+             busySeconds * 1e3, 100.0 * busySeconds / wallSeconds, wallSeconds);
+  fmt::print("  throughput: {:.1f} MB/s, {:.0f} strings/s\n",
+             static_cast<double>(totalBytes) / busySeconds / (1024.0 * 1024.0),
+             static_cast<double>(calls) / busySeconds);
+  fmt::print("  allocations: {} ({:.3f} per string, {} bytes)\n", allocations,
+             static_cast<double>(allocations) / static_cast<double>(calls),
+             allocatedBytes);
+
+  fmt::print("  {:<10} {:>9} {:>9} {:>10} {:>10} {:>10}\n", "hook", "strings",
+             "flagged", "p50 ns", "p99 ns", "max ns");
+  for (std::size_t h = 0; h < results.size(); ++h) {
+    auto &result = results[h];
+    if (result.latenciesNs.empty()) {
+      continue;
+    }
+    const auto max =
+        *std::max_element(result.latenciesNs.begin(), result.latenciesNs.end());
+    const auto p99 = Percentile(result.latenciesNs, 0.99);
+    const auto p50 = Percentile(result.latenciesNs, 0.50);
+    fmt::print("  {:<10} {:>9} {:>9} {:>10} {:>10} {:>10}\n",
+               Easy2Read::GetTextHookLabel(static_cast<TextHook>(h)),
+               result.latenciesNs.size(), result.flagged, p50, p99, max);
+  }
+
+  return 0;
+}